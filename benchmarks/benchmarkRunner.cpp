@@ -0,0 +1,113 @@
+#include "benchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+#include "diagnostics/allocationCounter.h"
+#include "diagnostics/processMemory.h"
+
+namespace {
+std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+}
+
+double BenchmarkResult::percentile(double p) const {
+    if (samplesMs.empty()) return 0.0;
+    std::vector<double> sorted = samplesMs;
+    std::ranges::sort(sorted);
+    auto rank = static_cast<std::size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+double BenchmarkResult::throughput() const {
+    double median = percentile(50);
+    return median > 0.0 ? itemsPerIteration / (median / 1000.0) : 0.0;
+}
+
+BenchmarkRunner::BenchmarkRunner(std::size_t iterations, std::string filter)
+    : iterations(std::max<std::size_t>(1, iterations)), filter(std::move(filter)) {}
+
+void BenchmarkRunner::run(std::string_view name, std::size_t datasetSize,
+                          std::size_t itemsPerIteration, const std::function<void()>& body,
+                          const std::function<void()>& setup) {
+    if (!filter.empty() && !name.contains(filter)) {
+        return;
+    }
+
+    BenchmarkResult result;
+    result.name = name;
+    result.datasetSize = datasetSize;
+    result.itemsPerIteration = itemsPerIteration;
+    result.samplesMs.reserve(iterations);
+    AllocationSnapshot total;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (setup) setup();
+
+        auto before = currentAllocations();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+        auto after = currentAllocations();
+
+        result.samplesMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        total.count += after.count - before.count;
+        total.bytes += after.bytes - before.bytes;
+    }
+
+    result.allocationsPerIteration = static_cast<double>(total.count) / iterations;
+    result.allocatedBytesPerIteration = static_cast<double>(total.bytes) / iterations;
+    result.peakResidentBytes = peakResidentMemory();
+    std::cout << std::format("{:<32} n={:<9} p50={:>10.3f} ms  p90={:>10.3f} ms  allocs={:.0f}\n",
+                             result.name, datasetSize, result.percentile(50),
+                             result.percentile(90), result.allocationsPerIteration);
+    results.push_back(std::move(result));
+}
+
+void BenchmarkRunner::printSummary() const {
+    std::cout << std::format("\n{:<32} {:>9} {:>10} {:>10} {:>10} {:>14} {:>12} {:>10}\n",
+                             "benchmark", "size", "p50 ms", "p90 ms", "p99 ms", "items/s",
+                             "allocs/op", "peak MB");
+    for (const auto& result : results) {
+        std::cout << std::format(
+            "{:<32} {:>9} {:>10.3f} {:>10.3f} {:>10.3f} {:>14.0f} {:>12.1f} {:>10.1f}\n",
+            result.name, result.datasetSize, result.percentile(50), result.percentile(90),
+            result.percentile(99), result.throughput(), result.allocationsPerIteration,
+            result.peakResidentBytes / (1024.0 * 1024.0));
+    }
+}
+
+bool BenchmarkRunner::writeJson(const std::string& path, std::string_view suite) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << std::format("{{\n  \"suite\": \"{}\",\n  \"iterations\": {},\n  \"results\": [\n",
+                        escapeJson(suite), iterations);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        file << std::format(
+            "    {{\"name\": \"{}\", \"size\": {}, \"items\": {}, \"min_ms\": {:.6f}, "
+            "\"p50_ms\": {:.6f}, \"p90_ms\": {:.6f}, \"p99_ms\": {:.6f}, \"max_ms\": {:.6f}, "
+            "\"items_per_second\": {:.2f}, \"allocations\": {:.2f}, \"allocated_bytes\": {:.2f}, "
+            "\"peak_rss_bytes\": {}}}{}\n",
+            escapeJson(r.name), r.datasetSize, r.itemsPerIteration, r.percentile(0),
+            r.percentile(50), r.percentile(90), r.percentile(99), r.percentile(100),
+            r.throughput(), r.allocationsPerIteration, r.allocatedBytesPerIteration,
+            r.peakResidentBytes, i + 1 < results.size() ? "," : "");
+    }
+    file << "  ]\n}\n";
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct BenchmarkResult {
+    std::string name;
+    std::size_t datasetSize = 0;
+    std::size_t itemsPerIteration = 0;
+    std::vector<double> samplesMs;
+    double allocationsPerIteration = 0.0;
+    double allocatedBytesPerIteration = 0.0;
+    std::size_t peakResidentBytes = 0;
+
+    double percentile(double p) const;
+    double throughput() const;
+};
+
+class BenchmarkRunner {
+public:
+    explicit BenchmarkRunner(std::size_t iterations = 10, std::string filter = {});
+
+    void run(std::string_view name, std::size_t datasetSize, std::size_t itemsPerIteration,
+             const std::function<void()>& body, const std::function<void()>& setup = {});
+
+    const std::vector<BenchmarkResult>& getResults() const { return results; }
+    void printSummary() const;
+    bool writeJson(const std::string& path, std::string_view suite) const;
+
+private:
+    std::size_t iterations;
+    std::string filter;
+    std::vector<BenchmarkResult> results;
+};
+
+#endif
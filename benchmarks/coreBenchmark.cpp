@@ -0,0 +1,163 @@
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmarkRunner.h"
+#include "entities/student.h"
+#include "managers/studentDatabase.h"
+#include "services/historyGradeGenerator.h"
+#include "services/semesterStatisticsCalculator.h"
+#include "services/syntheticStudentGenerator.h"
+
+namespace {
+struct Options {
+    std::vector<std::size_t> sizes = {1000, 10000, 100000};
+    std::size_t iterations = 10;
+    std::uint64_t seed = HistoryGradeGenerator::kDefaultSeed;
+    std::string output = "core-benchmark.json";
+    std::string filter;
+    std::filesystem::path dataDir = std::filesystem::temp_directory_path();
+};
+
+volatile std::size_t sink = 0;
+
+template <typename T>
+T parseNumber(std::string_view text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size()) {
+        throw std::invalid_argument("Invalid number: " + std::string(text));
+    }
+    return value;
+}
+
+std::vector<std::size_t> parseSizes(std::string_view text) {
+    std::vector<std::size_t> sizes;
+    while (!text.empty()) {
+        std::size_t comma = text.find(',');
+        sizes.push_back(parseNumber<std::size_t>(text.substr(0, comma)));
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+    }
+    return sizes;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view option = argv[i];
+        if (i + 1 >= argc) {
+            throw std::invalid_argument(std::string("Missing value for ") + std::string(option));
+        }
+        std::string_view value = argv[++i];
+        if (option == "--sizes") {
+            options.sizes = parseSizes(value);
+        } else if (option == "--iterations") {
+            options.iterations = parseNumber<std::size_t>(value);
+        } else if (option == "--seed") {
+            options.seed = parseNumber<std::uint64_t>(value);
+        } else if (option == "--output") {
+            options.output = value;
+        } else if (option == "--filter") {
+            options.filter = value;
+        } else if (option == "--data-dir") {
+            options.dataDir = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(option));
+        }
+    }
+    return options;
+}
+
+void runDataset(BenchmarkRunner& runner, const Options& options, std::size_t size) {
+    SyntheticStudentGenerator generator({}, options.seed);
+    StudentDatabase database;
+    database.addStudents(generator.generateRange(0, size));
+
+    auto dataPath = (options.dataDir / ("scholar-bench-" + std::to_string(size) + ".txt")).string();
+    auto savePath =
+        (options.dataDir / ("scholar-bench-" + std::to_string(size) + "-out.txt")).string();
+    database.saveToFile(dataPath);
+
+    StudentDatabase loaded;
+    runner.run("loadFromFile", size, size, [&] {
+        loaded.loadFromFile(dataPath);
+        sink = loaded.getStudentCount();
+    });
+    runner.run("saveToFile", size, size, [&] { database.saveToFile(savePath); });
+
+    runner.run("searchByName", size, size, [&] { sink = database.searchByName("ov").size(); });
+    runner.run("searchBySurname", size, size,
+               [&] { sink = database.searchBySurname("iva").size(); });
+    runner.run("searchByAverageGrade", size, size,
+               [&] { sink = database.searchByAverageGrade(7.0, 9.0).size(); });
+    runner.run("searchByAverageAtLeast", size, size,
+               [&] { sink = database.searchByAverageAtLeast(8.5).size(); });
+    runner.run("searchByAverageEqual", size, size,
+               [&] { sink = database.searchByAverageEqual(7.5).size(); });
+    runner.run("searchByCourse", size, size, [&] { sink = database.searchByCourse(2).size(); });
+    runner.run("searchStudents", size, size, [&] {
+        sink = database
+                   .searchStudents([](const std::shared_ptr<Student>& student) {
+                       return student->getIsBudget() && student->getMissedHours() < 12;
+                   })
+                   .size();
+    });
+
+    HistoryGradeGenerator historyGenerator(options.seed);
+    runner.run("recalculateScholarships", size, size, [&] {
+        database.updateAllStudents([&](Student& student) {
+            historyGenerator.materializeHistory(student);
+            student.recalculateScholarship();
+        });
+    });
+
+    auto students = database.getAllStudents();
+    SemesterStatisticsCalculator statistics;
+    runner.run("semesterStatistics", size, size,
+               [&] { sink = statistics.calculate(students).size(); });
+
+    runner.run(
+        "materializeHistory", size, size, [&] { database.materializeHistory(historyGenerator); },
+        [&] {
+            database.updateAllStudents([](Student& student) { student.clearPreviousGrades(); });
+        });
+
+    std::cout << database.memoryFootprint(MemoryFootprint::Mode::Exact).toText() << "\n";
+
+    std::error_code ignored;
+    std::filesystem::remove(dataPath, ignored);
+    std::filesystem::remove(savePath, ignored);
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n"
+                  << "Usage: " << argv[0]
+                  << " [--sizes 1000,10000,100000] [--iterations N] [--seed N]"
+                     " [--output FILE] [--filter NAME] [--data-dir DIR]\n";
+        return 2;
+    }
+
+    BenchmarkRunner runner(options.iterations, options.filter);
+    for (std::size_t size : options.sizes) {
+        runDataset(runner, options, size);
+    }
+
+    runner.printSummary();
+    if (!runner.writeJson(options.output, "core")) {
+        std::cerr << "Could not write " << options.output << "\n";
+        return 1;
+    }
+    std::cout << "\nResults written to " << options.output << "\n";
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <QApplication>
+#include <QHeaderView>
+#include <QScrollBar>
+#include <QTableView>
+#include <QTableWidget>
+#include <QTimer>
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmarkRunner.h"
+#include "entities/student.h"
+#include "managers/studentTableManager.h"
+#include "services/historyGradeGenerator.h"
+#include "services/studentStatisticsUpdater.h"
+#include "services/syntheticStudentGenerator.h"
+#include "ui/studentHistoryDialog.h"
+
+namespace {
+struct Options {
+    std::vector<std::size_t> sizes = {1000, 10000, 100000};
+    std::size_t iterations = 30;
+    std::uint64_t seed = HistoryGradeGenerator::kDefaultSeed;
+    std::string output = "ui-benchmark.json";
+    std::string filter;
+};
+
+template <typename T>
+T parseNumber(std::string_view text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size()) {
+        throw std::invalid_argument("Invalid number: " + std::string(text));
+    }
+    return value;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view option = argv[i];
+        if (i + 1 >= argc) {
+            throw std::invalid_argument(std::string("Missing value for ") + std::string(option));
+        }
+        std::string_view value = argv[++i];
+        if (option == "--sizes") {
+            options.sizes.clear();
+            while (!value.empty()) {
+                std::size_t comma = value.find(',');
+                options.sizes.push_back(parseNumber<std::size_t>(value.substr(0, comma)));
+                value = comma == std::string_view::npos ? std::string_view{}
+                                                        : value.substr(comma + 1);
+            }
+        } else if (option == "--iterations") {
+            options.iterations = parseNumber<std::size_t>(value);
+        } else if (option == "--seed") {
+            options.seed = parseNumber<std::uint64_t>(value);
+        } else if (option == "--output") {
+            options.output = value;
+        } else if (option == "--filter") {
+            options.filter = value;
+        } else {
+            throw std::invalid_argument("Unknown option: " + std::string(option));
+        }
+    }
+    return options;
+}
+
+void renderFrame(QWidget* widget) {
+    QCoreApplication::processEvents();
+    widget->repaint();
+}
+
+void runDataset(BenchmarkRunner& runner, const Options& options, std::size_t size) {
+    SyntheticStudentGenerator generator({}, options.seed);
+    auto students = generator.generateRange(0, size);
+
+    QTableView table;
+    table.resize(1400, 700);
+    StudentTableManager manager(&table);
+    manager.configure();
+    table.show();
+    renderFrame(table.viewport());
+
+    runner.run("tablePopulate", size, size, [&] {
+        manager.populate(students, false);
+        renderFrame(table.viewport());
+    });
+    runner.run("tablePopulateWithScholarship", size, size, [&] {
+        manager.populate(students, true);
+        renderFrame(table.viewport());
+    });
+
+    int row = 0;
+    const int rows = manager.rowCount();
+    runner.run("selectionFrame", size, 1, [&] {
+        row = (row + 7) % std::max(rows, 1);
+        table.setCurrentIndex(table.model()->index(row, 1));
+        renderFrame(table.viewport());
+    });
+
+    auto* scrollBar = table.verticalScrollBar();
+    runner.run("scrollPageFrame", size, 1, [&] {
+        int next = scrollBar->value() + scrollBar->pageStep();
+        scrollBar->setValue(next > scrollBar->maximum() ? 0 : next);
+        renderFrame(table.viewport());
+    });
+    runner.run("scrollJumpFrame", size, 1, [&] {
+        scrollBar->setValue(scrollBar->value() == 0 ? scrollBar->maximum() : 0);
+        renderFrame(table.viewport());
+    });
+
+    runner.run("headerSortFrame", size, size, [&] {
+        table.horizontalHeader()->sectionClicked(2);
+        renderFrame(table.viewport());
+    });
+
+    QTableWidget statisticsTable;
+    statisticsTable.setColumnCount(3);
+    statisticsTable.resize(800, 400);
+    statisticsTable.show();
+    StudentStatisticsUpdater statisticsUpdater;
+    runner.run("statisticsRefresh", size, size, [&] {
+        statisticsUpdater.updateSemesterTable(students, &statisticsTable);
+        renderFrame(statisticsTable.viewport());
+    });
+
+    StudentHistoryDialog historyDialog(&table);
+    std::size_t next = 0;
+    runner.run("historyDialogOpen", size, 1, [&] {
+        QTimer::singleShot(0, [] {
+            if (auto* dialog = QApplication::activeModalWidget()) {
+                dialog->close();
+            }
+        });
+        historyDialog.showHistory(students[next++ % students.size()]);
+    });
+}
+}
+
+int main(int argc, char* argv[]) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n"
+                  << "Usage: " << argv[0]
+                  << " [--sizes 1000,10000,100000] [--iterations N] [--seed N]"
+                     " [--output FILE] [--filter NAME]\n";
+        return 2;
+    }
+
+    BenchmarkRunner runner(options.iterations, options.filter);
+    for (std::size_t size : options.sizes) {
+        if (size == 0) continue;
+        runDataset(runner, options, size);
+    }
+
+    runner.printSummary();
+    if (!runner.writeJson(options.output, "ui")) {
+        std::cerr << "Could not write " << options.output << "\n";
+        return 1;
+    }
+    std::cout << "\nResults written to " << options.output << "\n";
+    return 0;
+}
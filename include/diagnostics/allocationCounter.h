@@ -0,0 +1,23 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct AllocationSnapshot {
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+    std::int64_t liveBytes = 0;
+};
+
+AllocationSnapshot currentAllocations();
+
+// Counting is active only in binaries that link allocationHooks.cpp (the benchmarks, or the
+// application and tools built with SCHOLAR_COUNT_ALLOCATIONS=ON); elsewhere snapshots stay zero.
+bool allocationCountingEnabled();
+
+void enableAllocationCounting();
+void recordAllocation(std::size_t requested, std::size_t usable);
+void recordRelease(std::size_t usable);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef MEMORYFOOTPRINT_H
+#define MEMORYFOOTPRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "diagnostics/allocationCounter.h"
+
+struct MemoryComponent {
+    std::string name;
+    std::size_t bytes = 0;
+};
+
+struct MemoryFootprint {
+    enum class Mode { Estimate, Exact };
+
+    Mode mode = Mode::Estimate;
+    std::size_t studentCount = 0;
+    std::vector<MemoryComponent> components;
+
+    void add(std::string_view name, std::size_t bytes);
+    void merge(const MemoryFootprint& other);
+    std::size_t totalBytes() const;
+    double bytesPerStudent() const;
+    std::string toText() const;
+};
+
+namespace memoryEstimate {
+inline constexpr std::size_t kSmallStringCapacity = 15;
+inline constexpr std::size_t kMapNodeHeaderBytes = 4 * sizeof(void*);
+inline constexpr std::size_t kSharedControlBlockBytes = sizeof(void*) + 2 * sizeof(int);
+
+std::size_t heapBlockBytes(std::size_t requested);
+
+inline std::size_t stringBytes(std::size_t length) {
+    return length > kSmallStringCapacity ? heapBlockBytes(length + 1) : 0;
+}
+
+template <typename T>
+std::size_t vectorBytes(const std::vector<T>& values) {
+    return values.capacity() ? heapBlockBytes(values.capacity() * sizeof(T)) : 0;
+}
+
+template <typename Key, typename Value>
+std::size_t mapBytes(const std::map<Key, Value>& values) {
+    using Node = std::pair<const Key, Value>;
+    return values.size() * heapBlockBytes(kMapNodeHeaderBytes + sizeof(Node));
+}
+}
+
+// Heap bytes that stay live after build() returns, as seen by the counting allocator.
+// Other threads allocating meanwhile skew the result.
+template <typename Build>
+std::size_t measureLiveBytes(Build&& build) {
+    const std::int64_t before = currentAllocations().liveBytes;
+    [[maybe_unused]] auto built = build();
+    const std::int64_t after = currentAllocations().liveBytes;
+    return after > before ? static_cast<std::size_t>(after - before) : 0;
+}
+
+#endif
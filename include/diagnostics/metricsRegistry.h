@@ -0,0 +1,91 @@
+#ifndef METRICSREGISTRY_H
+#define METRICSREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 5;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kMagnitudes = 40;
+
+    void record(std::uint64_t nanoseconds);
+    void reset();
+
+    std::uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    std::uint64_t max() const { return maximum.load(std::memory_order_relaxed); }
+    double mean() const;
+    std::uint64_t percentile(double p) const;
+
+private:
+    std::array<std::atomic<std::uint64_t>, kMagnitudes * kSubBuckets> buckets{};
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> maximum{0};
+
+    static std::size_t bucketFor(std::uint64_t value);
+    static std::uint64_t bucketUpperBound(std::size_t bucket);
+};
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance();
+
+    std::atomic<std::uint64_t>& counter(std::string_view name);
+    LatencyHistogram& histogram(std::string_view name);
+    void setGauge(std::string_view name, double value);
+
+    std::string exportText() const;
+    void reset();
+
+private:
+    MetricsRegistry() = default;
+
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<std::atomic<std::uint64_t>>, std::less<>> counters;
+    std::map<std::string, std::unique_ptr<LatencyHistogram>, std::less<>> histograms;
+    std::map<std::string, double, std::less<>> gauges;
+};
+
+inline void recordLatency(std::string_view operation,
+                          std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    MetricsRegistry::instance().histogram(operation).record(static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+class ScopedLatency {
+public:
+    explicit ScopedLatency(std::string_view operation)
+        : histogram(MetricsRegistry::instance().histogram(operation)),
+          start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedLatency() { stop(); }
+
+    void stop() {
+        if (stopped) return;
+        stopped = true;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyHistogram& histogram;
+    std::chrono::steady_clock::time_point start;
+    bool stopped = false;
+};
+
+#endif
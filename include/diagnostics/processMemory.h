@@ -0,0 +1,9 @@
+#ifndef PROCESSMEMORY_H
+#define PROCESSMEMORY_H
+
+#include <cstddef>
+
+std::size_t currentResidentMemory();
+std::size_t peakResidentMemory();
+
+#endif
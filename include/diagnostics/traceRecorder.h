@@ -0,0 +1,98 @@
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct TraceEvent {
+    const char* name = nullptr;
+    const char* category = nullptr;
+    std::uint64_t startNs = 0;
+    std::uint64_t durationNs = 0;
+};
+
+class TraceRecorder {
+public:
+    static constexpr std::size_t kEventsPerThread = 1 << 14;
+
+    static TraceRecorder& instance();
+
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool value);
+
+    static std::uint64_t now();
+    void record(const char* name, const char* category, std::uint64_t startNs,
+                std::uint64_t endNs);
+    void setThreadName(std::string name);
+
+    std::vector<TraceEvent> collect() const;
+    bool writeChromeTrace(const std::string& path) const;
+    void clear();
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<const char*> category{nullptr};
+        std::atomic<std::uint64_t> startNs{0};
+        std::atomic<std::uint64_t> durationNs{0};
+    };
+
+    struct ThreadBuffer {
+        std::unique_ptr<Slot[]> slots;
+        std::atomic<std::uint64_t> head{0};
+        std::atomic<std::uint64_t> floor{0};
+        std::uint32_t threadId = 0;
+        std::string threadName;
+    };
+
+    TraceRecorder() = default;
+    ThreadBuffer& localBuffer();
+    static std::vector<TraceEvent> snapshot(const ThreadBuffer& buffer);
+
+    static std::atomic<bool> enabled;
+    mutable std::mutex registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name, const char* category = "app")
+        : name(name), category(category) {
+        if (TraceRecorder::isEnabled()) {
+            startNs = TraceRecorder::now();
+        }
+    }
+
+    ~TraceScope() {
+        if (startNs != 0) {
+            TraceRecorder::instance().record(name, category, startNs, TraceRecorder::now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    std::uint64_t startNs = 0;
+};
+
+#define SCHOLAR_TRACE_CONCAT_INNER(a, b) a##b
+#define SCHOLAR_TRACE_CONCAT(a, b) SCHOLAR_TRACE_CONCAT_INNER(a, b)
+
+#ifdef SCHOLAR_DISABLE_TRACING
+#define TRACE_SCOPE(...) ((void)0)
+#else
+#define TRACE_SCOPE(...) TraceScope SCHOLAR_TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
+#endif
+
+#endif
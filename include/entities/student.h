@@ -1,11 +1,21 @@
     #ifndef STUDENT_H
     #define STUDENT_H
 
+    #include <expected>
     #include <map>
     #include <memory>
     #include <string>
     #include <string_view>
 
+    struct StudentValidationError {
+        enum class Field { Name, Surname, Course, Semester, AverageGrade };
+
+        Field field = Field::Name;
+        std::string reason;
+
+        std::string_view fieldName() const;
+    };
+
     class Student {
     private:
         std::string name;
@@ -20,6 +30,7 @@
         std::map<int, double> previousSemesterGrades;
         std::map<int, double> previousSemesterScholarships;  
         int budgetSemester = -1;  
+        bool historyMaterialized = false;
 
     public:
         Student(std::string_view name, std::string_view surname, int course, int semester,
@@ -27,6 +38,14 @@
 
         virtual ~Student() = default;
 
+        static std::expected<void, StudentValidationError> validate(std::string_view name,
+                                                                    std::string_view surname,
+                                                                    int course, int semester,
+                                                                    double averageGrade);
+        static std::expected<std::shared_ptr<Student>, StudentValidationError> create(
+            std::string_view name, std::string_view surname, int course, int semester,
+            double averageGrade, bool isBudget);
+
         virtual double calculateAverageGrade() const;
         virtual std::string getFullName() const;
         virtual std::string getStudentInfo() const;
@@ -47,6 +66,7 @@
         }
         int getBudgetSemester() const { return budgetSemester; }
         std::string getHistoryString() const;
+        bool isHistoryMaterialized() const { return historyMaterialized; }
 
         void setName(std::string_view name) { this->name = name; }
         void setSurname(std::string_view surname) { this->surname = surname; }
@@ -57,13 +77,25 @@
         void setMissedHours(int hours) { missedHours = hours; }
         void setHasSocialScholarship(bool has) { hasSocialScholarship = has; }
         void addPreviousGrade(int semester, double grade) { previousSemesterGrades[semester] = grade; }
-        void clearPreviousGrades() { previousSemesterGrades.clear(); }
+        void addPreviousScholarship(int semester, double amount) {
+            previousSemesterScholarships[semester] = amount;
+        }
+        void clearPreviousGrades() {
+            previousSemesterGrades.clear();
+            historyMaterialized = false;
+        }
+        void setHistoryMaterialized(bool materialized) { historyMaterialized = materialized; }
 
         void recalculateScholarship();
         double getScholarship() const { return scholarship; }
         void setScholarship(double s) { scholarship = s; }
 
     private:
+        struct Unchecked {};
+
+        Student(Unchecked, std::string_view name, std::string_view surname, int course,
+                int semester, double averageGrade, bool isBudget);
+
         void saveScholarshipsForBudgetSemesters(int startSemester);
         void saveHistoricalScholarships();
         bool isEligibleForScholarship() const;
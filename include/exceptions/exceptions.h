@@ -95,4 +95,10 @@ public:
         : DatabaseException(std::format("Student already exists: {}", name)) {}
 };
 
+class TransactionRejectedException : public DatabaseException {
+public:
+    explicit TransactionRejectedException(const std::string& problems)
+        : DatabaseException(std::format("Changes were not applied:\n{}", problems)) {}
+};
+
 #endif
\ No newline at end of file
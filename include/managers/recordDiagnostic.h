@@ -0,0 +1,26 @@
+#ifndef RECORDDIAGNOSTIC_H
+#define RECORDDIAGNOSTIC_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct RecordDiagnostic {
+    std::size_t line = 0;
+    std::string record;
+    std::string field;
+    std::string reason;
+
+    std::string toString() const;
+};
+
+struct LoadReport {
+    bool opened = false;
+    std::size_t accepted = 0;
+    std::vector<RecordDiagnostic> diagnostics;
+
+    bool clean() const { return diagnostics.empty(); }
+    std::string describe(std::size_t limit = 20) const;
+};
+
+#endif
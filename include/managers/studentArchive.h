@@ -0,0 +1,68 @@
+#ifndef STUDENTARCHIVE_H
+#define STUDENTARCHIVE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "entities/student.h"
+#include "managers/recordDiagnostic.h"
+
+class HistoryGradeGenerator;
+class StudentDatabase;
+
+struct ArchivedStudent {
+    std::shared_ptr<Student> student;
+    std::chrono::sys_days archivedOn;
+};
+
+class StudentArchive {
+public:
+    struct YearSummary {
+        std::size_t students = 0;
+        std::size_t budget = 0;
+        std::size_t paid = 0;
+        double totalScholarships = 0.0;
+    };
+
+    explicit StudentArchive(std::string_view filename = "students.archive");
+
+    std::string getFilename() const;
+    void setFilename(std::string_view newFilename);
+
+    void append(const std::vector<std::shared_ptr<Student>>& students);
+    void append(const std::vector<std::shared_ptr<Student>>& students,
+                std::chrono::sys_days archivedOn);
+    void moveFrom(StudentDatabase& database, const std::vector<std::shared_ptr<Student>>& students,
+                  const HistoryGradeGenerator& generator);
+
+    bool isLoaded() const;
+    LoadReport load();
+    std::vector<ArchivedStudent> records();
+    std::size_t size();
+    std::map<int, YearSummary> summarizeByYear();
+
+    static std::string filenameFor(std::string_view databaseFilename);
+    static void appendRecord(std::string& out, const Student& student,
+                             std::chrono::sys_days archivedOn);
+    static std::expected<ArchivedStudent, RecordDiagnostic> parseRecord(std::string_view line);
+
+private:
+    LoadReport loadLocked();
+    std::uintmax_t appendLocked(const std::vector<std::shared_ptr<Student>>& students,
+                                std::chrono::sys_days archivedOn);
+
+    mutable std::mutex mutex;
+    std::string filename;
+    bool loaded = false;
+    std::vector<ArchivedStudent> students;
+};
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef STUDENTCHANGEFEED_H
+#define STUDENTCHANGEFEED_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "entities/student.h"
+#include "managers/studentTransaction.h"
+
+enum class StudentField {
+    Name,
+    Surname,
+    Course,
+    Semester,
+    AverageGrade,
+    Funding,
+    MissedHours,
+    SocialScholarship,
+    Scholarship,
+    History
+};
+
+inline constexpr std::size_t kStudentFieldCount = 10;
+
+using StudentFieldValue = std::variant<std::monostate, bool, int, double, std::string>;
+
+class StudentFieldState {
+public:
+    explicit StudentFieldState(const Student& student);
+
+    const StudentFieldValue& operator[](StudentField field) const {
+        return values[static_cast<std::size_t>(field)];
+    }
+
+private:
+    std::array<StudentFieldValue, kStudentFieldCount> values;
+};
+
+struct StudentChange {
+    enum class Kind { Added, Removed, FieldChanged, Replaced };
+
+    Kind kind = Kind::FieldChanged;
+    std::shared_ptr<Student> student{};
+    std::shared_ptr<Student> previous{};
+    StudentField field = StudentField::Name;
+    StudentFieldValue oldValue{};
+    StudentFieldValue newValue{};
+};
+
+class StudentChangeFeed {
+public:
+    using Batch = std::vector<StudentChange>;
+    using Subscriber = std::function<void(const Batch& changes)>;
+
+    StudentChangeFeed() = default;
+    ~StudentChangeFeed();
+
+    StudentChangeFeed(const StudentChangeFeed&) = delete;
+    StudentChangeFeed& operator=(const StudentChangeFeed&) = delete;
+
+    std::size_t subscribe(Subscriber subscriber);
+    void unsubscribe(std::size_t id);
+    bool hasSubscribers() const { return subscriberCount.load(std::memory_order_acquire) > 0; }
+
+    // Writers must enqueue in sequence order (StudentDatabase does so under its write lock).
+    // Returns true when the caller has to call scheduleFlush(), preferably after unlocking.
+    bool enqueue(Batch changes, std::uint64_t sequence);
+    void scheduleFlush();
+    void flush();
+
+    static void diff(const StudentFieldState& before, const std::shared_ptr<Student>& previous,
+                     const std::shared_ptr<Student>& current, Batch& out);
+    static Batch coalesce(Batch changes);
+    static StudentChangeSet summarize(const Batch& changes);
+
+private:
+    struct Node {
+        std::uint64_t sequence = 0;
+        Batch changes;
+        Node* next = nullptr;
+    };
+
+    std::atomic<Node*> head{nullptr};
+    std::atomic<std::size_t> subscriberCount{0};
+    std::vector<std::pair<std::size_t, Subscriber>> subscribers;
+    std::size_t nextSubscriberId = 1;
+};
+
+#endif
@@ -2,25 +2,65 @@
 #define STUDENTDATABASE_H
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
-#include <ranges>
+#include <ostream>
+#include <shared_mutex>
+#include <stop_token>
+#include <string>
 #include <string_view>
 #include <vector>
 
+#include "diagnostics/memoryFootprint.h"
+#include "diagnostics/traceRecorder.h"
 #include "entities/student.h"
+#include "managers/recordDiagnostic.h"
+#include "managers/studentChangeFeed.h"
+#include "managers/studentStore.h"
+#include "managers/studentTransaction.h"
+#include "services/taskScheduler.h"
 
 
+class HistoryGradeGenerator;
+
+struct SemesterAdvance {
+    std::size_t advanced = 0;
+    std::vector<std::shared_ptr<Student>> graduated;
+};
+
 class StudentDatabase {
    private:
-    std::vector<std::shared_ptr<Student>> students;
+    mutable std::shared_mutex mutex;
+    std::atomic<int> pendingWriters{0};
+    StudentStore students;
+    StudentChangeFeed feed;
+    std::uint64_t changeSequence = 0;
     std::string filename = "students.txt";
 
+    std::shared_lock<std::shared_mutex> lockForRead() const;
+    std::unique_lock<std::shared_mutex> lockForWrite();
+    bool publishLocked(StudentChangeFeed::Batch changes);
+    bool updateMatching(const StudentStore::StudentFilter& filter,
+                        const StudentStore::StudentMutator& mutator, std::stop_token stopToken);
+    bool updateMatchingLocked(const StudentStore::StudentFilter& filter,
+                              const StudentStore::StudentMutator& mutator,
+                              std::stop_token stopToken, StudentChangeFeed::Batch& changes);
+
    public:
+    using StudentBatchHandler = std::function<void(
+        std::vector<std::shared_ptr<Student>>&& batch, std::size_t bytesRead, std::size_t totalBytes)>;
+    using StudentMutator = StudentStore::StudentMutator;
+    using Snapshot = StudentStore::Snapshot;
+
     StudentDatabase() = default;
     ~StudentDatabase() = default;
 
     void addStudent(std::shared_ptr<Student> student);
+    void addStudents(const std::vector<std::shared_ptr<Student>>& batch);
     void addStudent(std::string_view name, std::string_view surname, int course, int semester,
                     double averageGrade, bool isBudget);
 
@@ -28,14 +68,48 @@ class StudentDatabase {
     bool removeStudent(size_t index);
     bool removeStudentPtr(const std::shared_ptr<Student>& studentPtr);
 
-    std::vector<std::shared_ptr<Student>> getAllStudents() const { return students; }
-    size_t getStudentCount() const { return students.size(); }
+    Snapshot snapshot() const;
+    std::vector<std::shared_ptr<Student>> getAllStudents() const;
+    size_t getStudentCount() const;
     std::shared_ptr<Student> getStudent(size_t index) const;
 
+    std::shared_ptr<Student> updateStudent(const std::shared_ptr<Student>& student,
+                                           const StudentMutator& mutator);
+    bool updateAllStudents(const StudentMutator& mutator, std::stop_token stopToken = {});
+    bool materializeHistory(const HistoryGradeGenerator& generator, std::stop_token stopToken = {});
+    StudentChangeSet commit(const StudentTransaction& transaction);
+    SemesterAdvance advanceSemester(const HistoryGradeGenerator& generator);
+
+    static constexpr std::size_t kParallelSearchThreshold = 65536;
+    static constexpr std::size_t kParallelSearchGrain = 16384;
+    static constexpr std::size_t kParallelUpdateGrain = 1024;
+    static constexpr int kFinalSemester = 8;
+
     template <typename Predicate>
     std::vector<std::shared_ptr<Student>> searchStudents(Predicate predicate) const {
+        TRACE_SCOPE("StudentDatabase::searchStudents", "database");
+        const Snapshot students = snapshot();
         std::vector<std::shared_ptr<Student>> results;
-        std::ranges::copy_if(students, std::back_inserter(results), predicate);
+        if (students.size() < kParallelSearchThreshold) {
+            students.forEach([&results, &predicate](const std::shared_ptr<Student>& student) {
+                if (predicate(student)) results.push_back(student);
+            });
+            return results;
+        }
+
+        std::vector<std::vector<std::shared_ptr<Student>>> partials(students.chunkCount());
+        TaskScheduler::instance().parallelFor(
+            students.chunkCount(), kParallelSearchGrain / StudentStore::kChunkSize,
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t c = begin; c < end; ++c) {
+                    std::ranges::copy_if(students.chunk(c), std::back_inserter(partials[c]),
+                                         predicate);
+                }
+            });
+        for (auto& partial : partials) {
+            results.insert(results.end(), std::make_move_iterator(partial.begin()),
+                           std::make_move_iterator(partial.end()));
+        }
         return results;
     }
 
@@ -48,9 +122,22 @@ class StudentDatabase {
     std::vector<std::shared_ptr<Student>> searchByCourse(int course) const;
 
     bool saveToFile(std::string_view filename = "") const;
-    bool loadFromFile(std::string_view filename = "");
+    static bool saveSnapshot(const Snapshot& students, std::string_view filename);
+    static void writeFileHeader(std::ostream& out, std::size_t totalStudents);
+    static void appendRecord(std::string& out, const Student& student, std::size_t index);
+    static void writeFileFooter(std::ostream& out);
+    LoadReport loadFromFile(std::string_view filename = "");
+    static LoadReport streamFromFile(std::string_view filename, std::size_t batchSize,
+                                     const StudentBatchHandler& onBatch,
+                                     std::stop_token stopToken = {});
+    const std::string& getFilename() const { return filename; }
     void setFilename(std::string_view newFilename) { filename = newFilename; }
 
+    MemoryFootprint memoryFootprint(
+        MemoryFootprint::Mode mode = MemoryFootprint::Mode::Estimate) const;
+
+    StudentChangeFeed& changes() { return feed; }
+
     void clear();
 };
 
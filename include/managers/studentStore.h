@@ -0,0 +1,100 @@
+#ifndef STUDENTSTORE_H
+#define STUDENTSTORE_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "entities/student.h"
+
+struct StudentReplacement {
+    std::shared_ptr<Student> previous;
+    std::shared_ptr<Student> current;
+};
+
+class StudentStore {
+private:
+    struct Chunk {
+        std::vector<std::shared_ptr<Student>> students;
+    };
+
+    struct Spine {
+        std::vector<std::shared_ptr<Chunk>> chunks;
+        std::vector<std::size_t> ends;
+    };
+
+public:
+    using StudentPtr = std::shared_ptr<Student>;
+    using StudentMutator = std::function<void(Student&)>;
+    using StudentFilter = std::function<bool(const StudentPtr&)>;
+    using StudentEditor = std::function<void(std::size_t chunk, const StudentPtr& previous,
+                                             const StudentPtr& current)>;
+
+    static constexpr std::size_t kChunkSize = 1024;
+
+    class Snapshot {
+    public:
+        Snapshot() = default;
+
+        std::size_t size() const;
+        bool empty() const { return size() == 0; }
+        std::size_t chunkCount() const { return spine ? spine->chunks.size() : 0; }
+        std::span<const StudentPtr> chunk(std::size_t index) const {
+            return spine->chunks[index]->students;
+        }
+        const StudentPtr& operator[](std::size_t index) const;
+        std::vector<StudentPtr> toVector() const;
+        std::size_t estimatedIndexBytes() const;
+
+        template <typename Function>
+        void forEach(Function&& function) const {
+            for (std::size_t c = 0; c < chunkCount(); ++c) {
+                for (const auto& student : chunk(c)) {
+                    function(student);
+                }
+            }
+        }
+
+    private:
+        friend class StudentStore;
+        explicit Snapshot(std::shared_ptr<const Spine> spine) : spine(std::move(spine)) {}
+
+        std::shared_ptr<const Spine> spine;
+    };
+
+    StudentStore();
+
+    Snapshot snapshot() const { return Snapshot(spine); }
+    std::size_t size() const { return spine->ends.empty() ? 0 : spine->ends.back(); }
+    std::size_t chunkCount() const { return spine->chunks.size(); }
+    const StudentPtr& operator[](std::size_t index) const;
+    std::optional<std::size_t> find(const StudentPtr& student) const;
+
+    void pushBack(StudentPtr student);
+    void erase(std::size_t index);
+    void eraseAt(std::vector<std::size_t> indices);
+    std::vector<StudentPtr> eraseIf(const StudentFilter& filter);
+    void clear();
+
+    void replace(std::size_t index, StudentPtr student);
+    StudentPtr update(std::size_t index, const StudentMutator& mutator);
+    bool updateChunks(const StudentFilter& filter, const StudentEditor& editor, std::size_t grain,
+                      std::stop_token stopToken = {});
+
+private:
+    std::shared_ptr<Spine> spine;
+
+    Spine& mutableSpine();
+    Chunk& mutableChunk(std::size_t index);
+    void updateEnds(std::size_t fromChunk);
+    static std::pair<std::size_t, std::size_t> locate(const Spine& spine, std::size_t index);
+    static void editSlot(Chunk& chunk, std::size_t chunkIndex, std::size_t offset,
+                         const StudentEditor& editor);
+};
+
+#endif
@@ -4,22 +4,41 @@
 #include <memory>
 #include <vector>
 
+#include <QModelIndex>
 #include <QObject>
 
-class QTableWidget;
-class QTableWidgetItem;
-class QObject;
+#include "diagnostics/memoryFootprint.h"
+#include "managers/studentTransaction.h"
+#include "ui/studentActionDelegate.h"
+
+class QTableView;
 class Student;
+class StudentTableModel;
 
 class StudentTableManager : public QObject {
     Q_OBJECT
 
 public:
-    explicit StudentTableManager(QTableWidget* table, QObject* parent = nullptr);
+    explicit StudentTableManager(QTableView* table, QObject* parent = nullptr);
 
-    void configure(QObject* eventFilterOwner);
+    void configure();
     void populate(const std::vector<std::shared_ptr<Student>>& students, bool scholarshipsCalculated);
-    void updateRowNumbers();
+
+    void appendStudent(const std::shared_ptr<Student>& student);
+    void appendStudents(const std::vector<std::shared_ptr<Student>>& students);
+    void refreshRow(int row);
+    void replaceRow(int row, const std::shared_ptr<Student>& student);
+    void replaceStudents(const std::vector<StudentReplacement>& replacements);
+    void removeRow(int row);
+    void applyChanges(const StudentChangeSet& changes);
+
+    std::shared_ptr<Student> studentAt(int row) const;
+    std::vector<std::shared_ptr<Student>> selectedStudents() const;
+    int rowOf(const std::shared_ptr<Student>& student) const;
+    int rowCount() const;
+
+    MemoryFootprint memoryFootprint(
+        MemoryFootprint::Mode mode = MemoryFootprint::Mode::Estimate) const;
 
 signals:
     void editStudentRequested(int row);
@@ -27,27 +46,19 @@ signals:
     void viewHistoryRequested(int row);
 
 private slots:
-    void updateSelectionVisual() const;
-    void onEditClicked();
-    void onDeleteClicked();
-    void onViewClicked();
+    void onCurrentRowChanged(const QModelIndex& current, const QModelIndex& previous);
+    void onHeaderClicked(int section);
+    void onActionTriggered(int row, StudentActionDelegate::Action action);
 
 private:
-    QTableWidget* table = nullptr;
+    QTableView* table = nullptr;
+    StudentTableModel* model = nullptr;
+    StudentActionDelegate* actionDelegate = nullptr;
+    int actionDelegateColumn = -1;
 
-    void ensureScholarshipColumn(bool scholarshipsCalculated);
-    void applyMissedHoursStyling() const;
-    QWidget* createActionButtons(int row);
+    void attachActionDelegate();
+    void updateSortIndicator();
     void setupColumnWidths(bool scholarshipsCalculated);
-    void createRowItems(int row, int& rowNum, const std::shared_ptr<Student>& student,
-                       const QFont& itemFont, const QColor& defaultTextColor,
-                       bool scholarshipsCalculated);
-    QTableWidgetItem* createNumberItem(int rowNum, const QFont& itemFont);
-    QTableWidgetItem* createMissedHoursItem(const std::shared_ptr<Student>& student,
-                                            const QFont& itemFont, const QColor& defaultTextColor);
-    QTableWidgetItem* createScholarshipItem(double scholarship, const QFont& itemFont);
-    void applyItemForegroundColor(QTableWidgetItem* item, int col, const QColor& defaultColor) const;
-    bool shouldSkipColumn(int col) const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,99 @@
+#ifndef STUDENTTABLEMODEL_H
+#define STUDENTTABLEMODEL_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <QAbstractTableModel>
+#include <QFont>
+#include <QPersistentModelIndex>
+
+#include "managers/studentStore.h"
+#include "services/studentSorter.h"
+
+class Student;
+
+class StudentTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    enum class Column {
+        Number,
+        Name,
+        Surname,
+        Course,
+        Semester,
+        Funding,
+        AverageGrade,
+        MissedHours,
+        Social,
+        Scholarship,
+        Actions
+    };
+
+    enum Role {
+        ScholarshipAmountRole = Qt::UserRole + 2,
+        MissedHoursExceededRole = Qt::UserRole + 10
+    };
+
+    explicit StudentTableModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+    void setStudents(const std::vector<std::shared_ptr<Student>>& newStudents,
+                     bool showScholarship);
+    std::shared_ptr<Student> studentAt(int row) const;
+    int rowOf(const std::shared_ptr<Student>& student) const;
+
+    void appendStudent(const std::shared_ptr<Student>& student);
+    void appendStudents(const std::vector<std::shared_ptr<Student>>& batch);
+    void refreshStudent(int row);
+    void replaceStudent(int row, const std::shared_ptr<Student>& student);
+    void replaceStudents(const std::vector<StudentReplacement>& replacements);
+    void removeStudent(int row);
+    void removeStudents(const std::vector<std::shared_ptr<Student>>& removed);
+    void setHighlightedRow(int row);
+
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+    void sortBy(const std::vector<StudentSortKey>& keys);
+    const std::vector<StudentSortKey>& sortKeys() const { return activeSortKeys; }
+    static std::optional<StudentSortField> sortFieldFor(Column column);
+    static Column columnFor(StudentSortField field);
+    bool isScholarshipVisible() const { return scholarshipVisible; }
+
+    Column columnAt(int section) const;
+    int sectionOf(Column column) const;
+
+    MemoryFootprint memoryFootprint(MemoryFootprint::Mode mode) const;
+
+private:
+    static constexpr std::size_t kIncrementalChangeLimit = 64;
+
+    std::vector<std::shared_ptr<Student>> students;
+    std::vector<int> order;
+    std::vector<StudentSortKey> activeSortKeys;
+    StudentSorter sorter;
+    bool scholarshipVisible = false;
+    QPersistentModelIndex highlightedRow;
+
+    QFont itemFont;
+    QFont nameFont;
+    QFont boldFont;
+    QFont scholarshipFont;
+
+    QVariant displayData(const Student& student, Column column, int row) const;
+    QVariant foregroundData(const Student& student, Column column) const;
+    QVariant fontData(const Student& student, Column column) const;
+    QVariant alignmentData(Column column) const;
+    int sortedPosition(int baseIndex, int skipRow) const;
+    int refreshRow(int row);
+    void resort();
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef STUDENTTRANSACTION_H
+#define STUDENTTRANSACTION_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "entities/student.h"
+#include "managers/studentStore.h"
+
+struct StudentChangeSet {
+    std::vector<std::shared_ptr<Student>> added;
+    std::vector<StudentReplacement> updated;
+    std::vector<std::shared_ptr<Student>> removed;
+
+    bool empty() const { return added.empty() && updated.empty() && removed.empty(); }
+    std::size_t size() const { return added.size() + updated.size() + removed.size(); }
+};
+
+class StudentTransaction {
+public:
+    using StudentMutator = StudentStore::StudentMutator;
+
+    void add(std::shared_ptr<Student> student);
+    void update(std::shared_ptr<Student> student, StudentMutator mutator);
+    void remove(std::shared_ptr<Student> student);
+
+    bool empty() const { return added.empty() && updates.empty() && removed.empty(); }
+    std::size_t size() const { return added.size() + updates.size() + removed.size(); }
+
+private:
+    friend class StudentDatabase;
+
+    struct Update {
+        std::shared_ptr<Student> student;
+        StudentMutator mutator;
+    };
+
+    std::vector<std::shared_ptr<Student>> added;
+    std::vector<Update> updates;
+    std::vector<std::shared_ptr<Student>> removed;
+};
+
+#endif
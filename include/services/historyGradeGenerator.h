@@ -1,23 +1,40 @@
 #ifndef HISTORYGRADEGENERATOR_H
 #define HISTORYGRADEGENERATOR_H
 
+#include <cstdint>
 #include <memory>
-#include <random>
+#include <span>
 #include <vector>
 
+#include "services/randomEngine.h"
+
 class Student;
 
 class HistoryGradeGenerator {
 public:
+    using Engine = Xoshiro256PlusPlus;
+
+    static constexpr std::uint64_t kDefaultSeed = 0x5c401a25c401a25ULL;
+    static constexpr double kMinGrade = 5.0;
+    static constexpr double kMaxGrade = 10.0;
+
     HistoryGradeGenerator();
+    explicit HistoryGradeGenerator(std::uint64_t seed);
+
+    std::uint64_t getSeed() const { return seed; }
+    void setSeed(std::uint64_t newSeed) { seed = newSeed; }
+
+    Engine engineForStudent(const Student& student) const;
+    static double nextGrade(Engine& engine);
+    static void generateGrades(Engine& engine, std::span<double> grades);
 
     void ensureHistoryForNewStudent(Student& student, int currentSemester) const;
     void handleSemesterChange(Student& student, int oldSemester, double oldAverageGrade,
                               int newSemester) const;
-    void fillMissingHistoryForAll(const std::vector<std::shared_ptr<Student>>& students) const;
+    void materializeHistory(Student& student) const;
 
 private:
-    double generateRandomGrade() const;
+    std::uint64_t seed = kDefaultSeed;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,81 @@
+#ifndef RANDOMENGINE_H
+#define RANDOMENGINE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+class SplitMix64 {
+public:
+    explicit constexpr SplitMix64(std::uint64_t seed) : state(seed) {}
+
+    constexpr std::uint64_t operator()() {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    static constexpr std::uint64_t mix(std::uint64_t value) { return SplitMix64(value)(); }
+
+private:
+    std::uint64_t state;
+};
+
+class Xoshiro256PlusPlus {
+public:
+    using result_type = std::uint64_t;
+
+    explicit constexpr Xoshiro256PlusPlus(std::uint64_t seed) {
+        SplitMix64 seeder(seed);
+        for (auto& word : state) {
+            word = seeder();
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() {
+        const std::uint64_t result = rotl(state[0] + state[3], 23) + state[0];
+        const std::uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    constexpr void jump() {
+        constexpr std::array<std::uint64_t, 4> kJump = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                                        0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+        std::array<std::uint64_t, 4> jumped{};
+        for (std::uint64_t word : kJump) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & (std::uint64_t{1} << bit)) {
+                    for (std::size_t i = 0; i < state.size(); ++i) {
+                        jumped[i] ^= state[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        state = jumped;
+    }
+
+    constexpr double nextUnit() { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+private:
+    std::array<std::uint64_t, 4> state{};
+
+    static constexpr std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SEMESTERSTATISTICSCALCULATOR_H
+#define SEMESTERSTATISTICSCALCULATOR_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "services/historyGradeGenerator.h"
+
+class Student;
+
+class SemesterStatisticsCalculator {
+public:
+    static constexpr std::size_t kParallelGrain = 2048;
+
+    struct YearStats {
+        int winterCount = 0;
+        int summerCount = 0;
+        double winterTotal = 0.0;
+        double summerTotal = 0.0;
+    };
+
+    struct GeneralStats {
+        std::size_t total = 0;
+        std::size_t budget = 0;
+        std::size_t paid = 0;
+        double totalScholarship = 0.0;
+    };
+
+    std::map<int, YearStats> calculate(const std::vector<std::shared_ptr<Student>>& students) const;
+    static GeneralStats summarize(const std::vector<std::shared_ptr<Student>>& students);
+
+private:
+    HistoryGradeGenerator historyGenerator;
+
+    void accumulate(const std::shared_ptr<Student>& student,
+                    std::map<int, YearStats>& yearStats) const;
+    int getYearForSemester(int semester) const;
+    std::set<int> collectAllSemesters(const std::shared_ptr<Student>& student) const;
+    std::vector<int> getYearSemesters(int year) const;
+    bool wasStudentInYear(const std::set<int>& allSemesters, const std::vector<int>& yearSemesters) const;
+    bool wasOnSummerSemester(const std::set<int>& allSemesters, const std::vector<int>& yearSemesters) const;
+    double calculateWinterScholarship(const std::shared_ptr<Student>& student, int year,
+                                     const std::vector<int>& yearSemesters, int currentSem) const;
+    double calculateSummerScholarship(const std::shared_ptr<Student>& student, int year,
+                                     const std::vector<int>& yearSemesters, int currentSem) const;
+    double getScholarshipFromHistory(const std::shared_ptr<Student>& student, int sem) const;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef STUDENTSEARCHINDEX_H
+#define STUDENTSEARCHINDEX_H
+
+#include <QString>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <vector>
+
+#include "diagnostics/memoryFootprint.h"
+#include "managers/studentStore.h"
+
+class Student;
+
+class StudentSearchIndex {
+public:
+    struct Entry {
+        QString key;
+        std::shared_ptr<Student> student;
+    };
+    using Snapshot = std::shared_ptr<const std::vector<Entry>>;
+
+    StudentSearchIndex();
+
+    void rebuild(const std::vector<std::shared_ptr<Student>>& students);
+    void add(const std::shared_ptr<Student>& student);
+    void add(const std::vector<std::shared_ptr<Student>>& students);
+    void update(const std::shared_ptr<Student>& student);
+    void replace(const std::vector<StudentReplacement>& replacements);
+    void remove(const std::shared_ptr<Student>& student);
+    void remove(const std::vector<std::shared_ptr<Student>>& students);
+
+    Snapshot snapshot() const { return entries; }
+    std::uint64_t version() const { return currentVersion; }
+    std::size_t size() const { return entries->size(); }
+    MemoryFootprint memoryFootprint() const;
+
+    static QString fold(const QString& text);
+    static std::optional<std::vector<int>> search(const std::vector<Entry>& entries,
+                                                  const QString& foldedQuery,
+                                                  const std::vector<int>* candidates,
+                                                  std::stop_token stopToken);
+
+private:
+    std::shared_ptr<std::vector<Entry>> entries;
+    std::uint64_t currentVersion = 0;
+
+    static QString keyFor(const Student& student);
+    std::vector<Entry>& mutableEntries();
+};
+
+#endif
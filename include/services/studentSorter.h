@@ -0,0 +1,71 @@
+#ifndef STUDENTSORTER_H
+#define STUDENTSORTER_H
+
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <compare>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "diagnostics/memoryFootprint.h"
+
+class Student;
+
+enum class StudentSortField {
+    Name,
+    Surname,
+    Course,
+    Semester,
+    Funding,
+    AverageGrade,
+    MissedHours,
+    Social,
+    Scholarship
+};
+
+struct StudentSortKey {
+    StudentSortField field = StudentSortField::Surname;
+    bool ascending = true;
+
+    auto operator<=>(const StudentSortKey&) const = default;
+};
+
+class StudentSorter {
+public:
+    using Students = std::vector<std::shared_ptr<Student>>;
+
+    static constexpr std::size_t kParallelThreshold = 50000;
+    static constexpr std::size_t kCachedOrderLimit = 8;
+
+    StudentSorter();
+
+    void reset();
+    void append(const Student& student);
+    void update(std::size_t index, const Student& student);
+    void remove(std::size_t index);
+
+    std::vector<int> sortedOrder(const Students& students, const std::vector<StudentSortKey>& keys);
+
+    void prepare(const Students& students, const std::vector<StudentSortKey>& keys);
+    bool less(const std::vector<StudentSortKey>& keys, int lhs, int rhs) const;
+
+    MemoryFootprint memoryFootprint(const Students& students, MemoryFootprint::Mode mode) const;
+
+private:
+    QCollator collator;
+    std::size_t count = 0;
+
+    std::map<StudentSortField, std::vector<QCollatorSortKey>> textKeys;
+    std::map<StudentSortField, std::vector<double>> numericKeys;
+    std::map<std::vector<StudentSortKey>, std::vector<int>> cachedOrders;
+
+    static bool isTextField(StudentSortField field);
+    static double numericValue(const Student& student, StudentSortField field);
+    QCollatorSortKey textKey(const Student& student, StudentSortField field) const;
+    int compareField(StudentSortField field, int lhs, int rhs) const;
+    void invalidateOrders() { cachedOrders.clear(); }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef SYNTHETICSTUDENTGENERATOR_H
+#define SYNTHETICSTUDENTGENERATOR_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "services/historyGradeGenerator.h"
+
+class Student;
+
+struct SyntheticStudentProfile {
+    std::array<double, 8> semesterWeights = {1, 1, 1, 1, 1, 1, 1, 1};
+    double budgetShare = 0.6;
+    double gradeMean = 7.5;
+    double gradeStdDev = 1.3;
+    double missedHoursMean = 4.0;
+    double socialShare = 0.05;
+    bool generateHistory = true;
+
+    void validate() const;
+};
+
+class SyntheticStudentGenerator {
+public:
+    explicit SyntheticStudentGenerator(SyntheticStudentProfile profile = {},
+                                       std::uint64_t seed = HistoryGradeGenerator::kDefaultSeed);
+
+    std::shared_ptr<Student> generate(std::uint64_t index) const;
+    std::vector<std::shared_ptr<Student>> generateRange(std::uint64_t first,
+                                                        std::size_t count) const;
+
+    const SyntheticStudentProfile& getProfile() const { return profile; }
+    std::uint64_t getSeed() const { return seed; }
+
+private:
+    SyntheticStudentProfile profile;
+    std::uint64_t seed;
+    double totalSemesterWeight = 0.0;
+    HistoryGradeGenerator historyGenerator;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+enum class TaskPriority { Interactive, Background };
+
+class TaskScheduler {
+public:
+    using Task = std::move_only_function<void()>;
+    using MainThreadTask = std::function<void()>;
+    using MainThreadDispatcher = std::function<void(MainThreadTask)>;
+    using RangeBody = std::function<void(std::size_t begin, std::size_t end)>;
+
+    explicit TaskScheduler(unsigned workerCount = std::thread::hardware_concurrency());
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    static TaskScheduler& instance();
+    static void setInstanceWorkerCount(unsigned workerCount);
+
+    void submit(Task task, TaskPriority priority = TaskPriority::Background,
+                std::stop_token stopToken = {});
+
+    template <typename Function>
+    auto async(Function function, TaskPriority priority = TaskPriority::Background)
+        -> std::future<std::invoke_result_t<Function&>> {
+        std::packaged_task<std::invoke_result_t<Function&>()> task(std::move(function));
+        auto future = task.get_future();
+        submit(std::move(task), priority);
+        return future;
+    }
+
+    bool parallelFor(std::size_t count, std::size_t grain, const RangeBody& body,
+                     TaskPriority priority = TaskPriority::Interactive,
+                     std::stop_token stopToken = {});
+
+    void setMainThreadDispatcher(MainThreadDispatcher dispatcher);
+    void postToMainThread(MainThreadTask task);
+
+    // Rethrows the first exception that escaped a submitted task since the last call.
+    void waitForIdle();
+    unsigned workerCount() const { return static_cast<unsigned>(workers.size()); }
+
+private:
+    static constexpr std::size_t kPriorityCount = 2;
+    using Queues = std::array<std::deque<Task>, kPriorityCount>;
+
+    struct Worker {
+        std::mutex mutex;
+        Queues queues;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::jthread> threads;
+
+    std::mutex injectionMutex;
+    Queues injection;
+
+    std::mutex stateMutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> running{0};
+    bool stopping = false;
+    std::exception_ptr unhandled;
+
+    std::mutex dispatcherMutex;
+    MainThreadDispatcher mainThreadDispatcher;
+
+    void workerLoop(std::size_t index);
+    std::optional<Task> takeTask(std::optional<std::size_t> self);
+    void runTask(Task& task);
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ARCHIVEPANEL_H
+#define ARCHIVEPANEL_H
+
+#include <QString>
+#include <QWidget>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "managers/studentArchive.h"
+
+class QLabel;
+class QLineEdit;
+class QTableView;
+class QTableWidget;
+class StudentTableModel;
+
+class ArchivePanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ArchivePanel(StudentArchive& archive, QWidget* parent = nullptr);
+
+public slots:
+    void refresh();
+
+signals:
+    void historyRequested(const std::shared_ptr<Student>& student);
+
+protected:
+    void showEvent(QShowEvent* event) override;
+
+private slots:
+    void applyFilter();
+
+private:
+    void startLoading();
+    void applyRecords(std::vector<ArchivedStudent> loaded,
+                      const std::map<int, StudentArchive::YearSummary>& years,
+                      const QString& error);
+
+    StudentArchive& archive;
+    std::vector<ArchivedStudent> records;
+    bool loadRequested = false;
+
+    QLabel* summaryLabel = nullptr;
+    QLineEdit* filterEdit = nullptr;
+    QTableWidget* yearTable = nullptr;
+    QTableView* studentTable = nullptr;
+    StudentTableModel* model = nullptr;
+};
+
+#endif
@@ -7,17 +7,27 @@
 #include <QMainWindow>
 #include <QMessageBox>
 #include <QMouseEvent>
+#include <QProgressBar>
 #include <QPushButton>
 #include <QTabWidget>
+#include <QTableView>
 #include <QTableWidget>
+#include <QTimer>
+#include <chrono>
 #include <memory>
+#include <stop_token>
+#include <vector>
 
 #include "entities/student.h"
+#include "managers/studentArchive.h"
 #include "managers/studentDatabase.h"
 #include "managers/studentTableManager.h"
 #include "services/historyGradeGenerator.h"
 #include "services/scholarshipCalculator.h"
+#include "services/studentSearchIndex.h"
 #include "services/studentStatisticsUpdater.h"
+#include "ui/archivePanel.h"
+#include "ui/metricsPanel.h"
 #include "ui/studentHistoryDialog.h"
 
 class MainWindow : public QMainWindow {
@@ -27,17 +37,21 @@ class MainWindow : public QMainWindow {
     explicit MainWindow(QWidget* parent = nullptr);
     ~MainWindow() override;
 
-    bool eventFilter(QObject* obj, QEvent* event) override;
-
    private slots:
     void addStudent();
     void searchStudent();
+    void scheduleSearch();
     void calculateAllScholarships();
+    void advanceSemester();
     void showAllStudents();
     void updateStudentTable(const std::vector<std::shared_ptr<Student>>& studentList);
     void editSelectedStudent();
+    void bulkEditSelectedStudents();
+    void archiveSelectedStudents();
     void deleteSelectedStudent();
     void showStudentHistory();
+    void toggleTracing();
+    void toggleMetricsPanel();
 
    private:
     void setupUI();
@@ -46,34 +60,71 @@ class MainWindow : public QMainWindow {
     void createStatisticsTab(QWidget* tabWidget);
     void createStudentTable();
     void updateStatistics();
-    void fillMissingHistoryGrades() const;
+    void refreshSemesterTable();
     void saveDatabaseToFile();
+    void finishSaving(const QString& error, bool saved,
+                      const std::vector<std::shared_ptr<Student>>& graduates);
+    void onStudentsChanged(const StudentChangeFeed::Batch& changes);
+    void startLoading();
+    void appendLoadedStudents(const std::vector<std::shared_ptr<Student>>& batch,
+                              std::size_t bytesRead, std::size_t totalBytes);
+    void finishLoading(const QString& errorTitle, const QString& error);
+    void runDeferredStartupTasks();
+    void applySearchResults(quint64 generation, const QString& query, std::uint64_t indexVersion,
+                            const StudentSearchIndex::Snapshot& snapshot,
+                            std::vector<int> matches);
 
     StudentDatabase database;
+    StudentArchive archive;
 
     QTabWidget* tabWidget = nullptr;
 
-    QTableWidget* studentTable = nullptr;
+    QTableView* studentTable = nullptr;
     QLineEdit* searchEdit = nullptr;
     QPushButton* searchButton = nullptr;
+    QLabel* searchStatusLabel = nullptr;
+    QTimer* searchDebounce = nullptr;
     QPushButton* addStudentButton = nullptr;
+    QPushButton* bulkEditButton = nullptr;
+    QPushButton* archiveButton = nullptr;
 
     QLabel* totalStudentsLabel = nullptr;
     QLabel* budgetStudentsLabel = nullptr;
     QLabel* paidStudentsLabel = nullptr;
     QLabel* totalScholarshipLabel = nullptr;
     QPushButton* calculateButton = nullptr;
+    QPushButton* advanceSemesterButton = nullptr;
     QTableWidget* semesterStatsTable = nullptr;
 
-    std::vector<std::shared_ptr<Student>> currentView;
     bool scholarshipsCalculated = false;
     bool scholarshipsNeedRecalculation = false;
+    bool semesterStatsDirty = true;
     QLabel* recalculationWarning = nullptr;
 
     std::unique_ptr<StudentTableManager> tableManager;
-    [[no_unique_address]] StudentStatisticsUpdater statisticsUpdater;
-    [[no_unique_address]] HistoryGradeGenerator historyGradeGenerator;
+    StudentStatisticsUpdater statisticsUpdater;
+    HistoryGradeGenerator historyGradeGenerator;
     std::unique_ptr<StudentHistoryDialog> historyDialog;
+
+    StudentSearchIndex searchIndex;
+    std::stop_source searchStop;
+    quint64 searchGeneration = 0;
+    QString lastSearchQuery;
+    std::uint64_t lastSearchVersion = 0;
+    std::vector<int> lastSearchMatches;
+    std::chrono::steady_clock::time_point searchStarted;
+
+    QProgressBar* loadProgress = nullptr;
+    std::stop_source loadStop;
+    bool loading = false;
+    bool saveAfterLoad = false;
+    bool saving = false;
+    bool saveAgain = false;
+    std::vector<std::shared_ptr<Student>> pendingGraduates;
+    std::chrono::steady_clock::time_point loadStarted;
+
+    MetricsPanel* metricsPanel = nullptr;
+    ArchivePanel* archivePanel = nullptr;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef METRICSPANEL_H
+#define METRICSPANEL_H
+
+#include <QString>
+#include <QWidget>
+#include <functional>
+
+#include "diagnostics/memoryFootprint.h"
+
+class QPlainTextEdit;
+class QTimer;
+
+class MetricsPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    using MemoryReportProvider = std::function<QString(MemoryFootprint::Mode)>;
+
+    explicit MetricsPanel(QWidget* parent = nullptr);
+
+    void setMemoryReportProvider(MemoryReportProvider provider);
+
+public slots:
+    void refresh();
+
+protected:
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+
+private slots:
+    void resetMetrics();
+    void exportMetrics();
+    void measureMemory(MemoryFootprint::Mode mode);
+
+private:
+    QString reportText() const;
+
+    QPlainTextEdit* metricsView = nullptr;
+    QTimer* refreshTimer = nullptr;
+    MemoryReportProvider memoryReportProvider;
+    QString memoryReport;
+};
+
+#endif
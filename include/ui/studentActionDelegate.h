@@ -0,0 +1,62 @@
+#ifndef STUDENTACTIONDELEGATE_H
+#define STUDENTACTIONDELEGATE_H
+
+#include <array>
+#include <optional>
+
+#include <QColor>
+#include <QPersistentModelIndex>
+#include <QString>
+#include <QStyledItemDelegate>
+
+class QAbstractItemView;
+
+class StudentActionDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+
+public:
+    enum class Action { Edit, ViewHistory, Delete };
+
+    explicit StudentActionDelegate(QAbstractItemView* view);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option,
+               const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    bool editorEvent(QEvent* event, QAbstractItemModel* model, const QStyleOptionViewItem& option,
+                     const QModelIndex& index) override;
+    bool helpEvent(QHelpEvent* event, QAbstractItemView* view, const QStyleOptionViewItem& option,
+                   const QModelIndex& index) override;
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+signals:
+    void actionTriggered(int row, StudentActionDelegate::Action action);
+
+private:
+    struct ButtonStyle {
+        Action action;
+        QString glyph;
+        QString toolTip;
+        int fontPixelSize;
+        QColor background;
+        QColor hover;
+        QColor pressed;
+    };
+
+    static constexpr int kButtonSize = 27;
+    static constexpr int kButtonSpacing = 5;
+
+    QAbstractItemView* view = nullptr;
+    std::array<ButtonStyle, 3> buttons;
+
+    QPersistentModelIndex hoveredIndex;
+    std::optional<Action> hoveredAction;
+    QPersistentModelIndex pressedIndex;
+    std::optional<Action> pressedAction;
+
+    QRect buttonRect(const QRect& cell, int button) const;
+    std::optional<Action> hitTest(const QRect& cell, const QPoint& pos) const;
+    const ButtonStyle* styleFor(Action action) const;
+    void setHovered(const QModelIndex& index, std::optional<Action> action);
+};
+
+#endif
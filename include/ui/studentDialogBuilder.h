@@ -1,7 +1,9 @@
 #ifndef STUDENTDIALOGBUILDER_H
 #define STUDENTDIALOGBUILDER_H
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <QString>
 
 class QWidget;
@@ -49,6 +51,36 @@ private:
     bool socialScholarship = false;
 };
 
+class StudentBulkEditResult {
+public:
+    enum class SemesterChange { Keep, Advance, Set };
+
+    bool isAccepted() const;
+    void setAccepted(bool accepted);
+    bool hasChanges() const;
+
+    SemesterChange getSemesterChange() const;
+    void setSemesterChange(SemesterChange change, int semester = 1);
+    int semesterFor(int currentSemester) const;
+
+    std::optional<bool> isBudget() const;
+    void setIsBudget(std::optional<bool> budget);
+
+    std::optional<int> getMissedHours() const;
+    void setMissedHours(std::optional<int> hours);
+
+    std::optional<bool> hasSocialScholarship() const;
+    void setHasSocialScholarship(std::optional<bool> hasSocial);
+
+private:
+    bool accepted = false;
+    SemesterChange semesterChange = SemesterChange::Keep;
+    int semester = 1;
+    std::optional<bool> budget;
+    std::optional<int> missedHours;
+    std::optional<bool> socialScholarship;
+};
+
 struct DialogFields {
     class QLineEdit* nameField = nullptr;
     class QLineEdit* surnameField = nullptr;
@@ -65,6 +97,7 @@ public:
 
     StudentDialogResult showAddDialog() const;
     StudentDialogResult showEditDialog(const std::shared_ptr<Student>& student) const;
+    StudentBulkEditResult showBulkEditDialog(std::size_t studentCount) const;
 
 private:
     StudentDialogResult showDialog(const QString& title, const QString& okButtonText,
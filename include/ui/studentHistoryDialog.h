@@ -5,6 +5,8 @@
 
 #include <QString>
 
+#include "services/historyGradeGenerator.h"
+
 class QWidget;
 class QDialog;
 class QTableWidget;
@@ -19,6 +21,7 @@ public:
 
 private:
     QWidget* parentWidget = nullptr;
+    HistoryGradeGenerator historyGenerator;
 
     int getAdmissionYearFromSemester(int semester) const;
     int getYearForSemester(int semester, int admissionYear) const;
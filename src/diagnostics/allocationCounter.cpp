@@ -0,0 +1,30 @@
+#include "diagnostics/allocationCounter.h"
+
+#include <atomic>
+
+namespace {
+std::atomic<bool> countingEnabled{false};
+std::atomic<std::uint64_t> allocationCount{0};
+std::atomic<std::uint64_t> allocationBytes{0};
+std::atomic<std::int64_t> liveBytes{0};
+}
+
+AllocationSnapshot currentAllocations() {
+    return {allocationCount.load(std::memory_order_relaxed),
+            allocationBytes.load(std::memory_order_relaxed),
+            liveBytes.load(std::memory_order_relaxed)};
+}
+
+bool allocationCountingEnabled() { return countingEnabled.load(std::memory_order_relaxed); }
+
+void enableAllocationCounting() { countingEnabled.store(true, std::memory_order_relaxed); }
+
+void recordAllocation(std::size_t requested, std::size_t usable) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(requested, std::memory_order_relaxed);
+    liveBytes.fetch_add(static_cast<std::int64_t>(usable), std::memory_order_relaxed);
+}
+
+void recordRelease(std::size_t usable) {
+    liveBytes.fetch_sub(static_cast<std::int64_t>(usable), std::memory_order_relaxed);
+}
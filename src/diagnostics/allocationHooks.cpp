@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "diagnostics/allocationCounter.h"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+[[maybe_unused]] const bool countingRegistered = (enableAllocationCounting(), true);
+
+std::size_t usableSize(void* memory, std::size_t alignment = 0) {
+#if defined(_WIN32)
+    return alignment ? _aligned_msize(memory, alignment, 0) : _msize(memory);
+#elif defined(__APPLE__)
+    (void)alignment;
+    return malloc_size(memory);
+#else
+    (void)alignment;
+    return malloc_usable_size(memory);
+#endif
+}
+
+void* track(void* memory, std::size_t size, std::size_t alignment = 0) {
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    recordAllocation(size, usableSize(memory, alignment));
+    return memory;
+}
+
+void* countedAllocate(std::size_t size) { return track(std::malloc(size == 0 ? 1 : size), size); }
+
+void* countedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+    auto align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+#ifdef _WIN32
+    return track(_aligned_malloc(rounded, align), size, align);
+#else
+    return track(std::aligned_alloc(align, rounded), size, align);
+#endif
+}
+
+void release(void* memory) {
+    if (!memory) return;
+    recordRelease(usableSize(memory));
+    std::free(memory);
+}
+
+void releaseAligned(void* memory, std::align_val_t alignment) {
+    if (!memory) return;
+    recordRelease(usableSize(memory, static_cast<std::size_t>(alignment)));
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+}
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAllocateAligned(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return countedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept { release(memory); }
+void operator delete[](void* memory) noexcept { release(memory); }
+void operator delete(void* memory, std::size_t) noexcept { release(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { release(memory); }
+void operator delete(void* memory, std::align_val_t alignment) noexcept {
+    releaseAligned(memory, alignment);
+}
+void operator delete[](void* memory, std::align_val_t alignment) noexcept {
+    releaseAligned(memory, alignment);
+}
+void operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept {
+    releaseAligned(memory, alignment);
+}
+void operator delete[](void* memory, std::size_t, std::align_val_t alignment) noexcept {
+    releaseAligned(memory, alignment);
+}
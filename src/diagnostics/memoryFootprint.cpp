@@ -0,0 +1,62 @@
+#include "diagnostics/memoryFootprint.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+
+void MemoryFootprint::add(std::string_view name, std::size_t bytes) {
+    auto it = std::ranges::find(components, name, &MemoryComponent::name);
+    if (it != components.end()) {
+        it->bytes += bytes;
+    } else {
+        components.push_back({std::string(name), bytes});
+    }
+}
+
+void MemoryFootprint::merge(const MemoryFootprint& other) {
+    studentCount = std::max(studentCount, other.studentCount);
+    for (const auto& component : other.components) {
+        add(component.name, component.bytes);
+    }
+}
+
+std::size_t MemoryFootprint::totalBytes() const {
+    std::size_t total = 0;
+    for (const auto& component : components) {
+        total += component.bytes;
+    }
+    return total;
+}
+
+double MemoryFootprint::bytesPerStudent() const {
+    return studentCount ? static_cast<double>(totalBytes()) / studentCount : 0.0;
+}
+
+std::string MemoryFootprint::toText() const {
+    auto perStudent = [this](std::size_t bytes) {
+        return studentCount ? static_cast<double>(bytes) / studentCount : 0.0;
+    };
+
+    std::string text;
+    auto out = std::back_inserter(text);
+    std::format_to(out, "# Memory ({}, {} students)\n",
+                   mode == Mode::Exact ? "exact" : "estimate", studentCount);
+    std::format_to(out, "{:<28} {:>12} {:>14}\n", "component", "KiB", "bytes/student");
+    for (const auto& component : components) {
+        std::format_to(out, "{:<28} {:>12.1f} {:>14.1f}\n", component.name,
+                       component.bytes / 1024.0, perStudent(component.bytes));
+    }
+    std::format_to(out, "{:<28} {:>12.1f} {:>14.1f}\n", "total", totalBytes() / 1024.0,
+                   bytesPerStudent());
+    return text;
+}
+
+namespace memoryEstimate {
+std::size_t heapBlockBytes(std::size_t requested) {
+    constexpr std::size_t kHeader = sizeof(std::size_t);
+    constexpr std::size_t kAlignment = 2 * sizeof(std::size_t);
+    constexpr std::size_t kMinimumBlock = 4 * sizeof(std::size_t);
+    std::size_t block = (requested + kHeader + kAlignment - 1) / kAlignment * kAlignment;
+    return std::max(block, kMinimumBlock);
+}
+}
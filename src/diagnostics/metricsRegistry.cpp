@@ -0,0 +1,155 @@
+#include "diagnostics/metricsRegistry.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+
+#include "diagnostics/allocationCounter.h"
+#include "diagnostics/processMemory.h"
+
+std::size_t LatencyHistogram::bucketFor(std::uint64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<std::size_t>(value);
+    }
+    int magnitude = std::bit_width(value) - kSubBucketBits;
+    auto subBucket = static_cast<std::size_t>(value >> magnitude) - kSubBuckets / 2;
+    std::size_t bucket = kSubBuckets + (magnitude - 1) * (kSubBuckets / 2) + subBucket;
+    return std::min<std::size_t>(bucket, kMagnitudes * kSubBuckets - 1);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t bucket) {
+    if (bucket < kSubBuckets) {
+        return bucket;
+    }
+    std::size_t offset = bucket - kSubBuckets;
+    int magnitude = static_cast<int>(offset / (kSubBuckets / 2)) + 1;
+    std::uint64_t subBucket = offset % (kSubBuckets / 2) + kSubBuckets / 2;
+    return ((subBucket + 1) << magnitude) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds) {
+    buckets[bucketFor(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    std::uint64_t current = maximum.load(std::memory_order_relaxed);
+    while (nanoseconds > current &&
+           !maximum.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const {
+    std::uint64_t n = count();
+    return n == 0 ? 0.0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / n;
+}
+
+std::uint64_t LatencyHistogram::percentile(double p) const {
+    std::uint64_t n = count();
+    if (n == 0) return 0;
+
+    auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * n));
+    rank = std::max<std::uint64_t>(rank, 1);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), max());
+        }
+    }
+    return max();
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+std::atomic<std::uint64_t>& MetricsRegistry::counter(std::string_view name) {
+    std::scoped_lock lock(mutex);
+    auto it = counters.find(name);
+    if (it == counters.end()) {
+        it = counters.emplace(std::string(name), std::make_unique<std::atomic<std::uint64_t>>(0))
+                 .first;
+    }
+    return *it->second;
+}
+
+LatencyHistogram& MetricsRegistry::histogram(std::string_view name) {
+    std::scoped_lock lock(mutex);
+    auto it = histograms.find(name);
+    if (it == histograms.end()) {
+        it = histograms.emplace(std::string(name), std::make_unique<LatencyHistogram>()).first;
+    }
+    return *it->second;
+}
+
+void MetricsRegistry::setGauge(std::string_view name, double value) {
+    std::scoped_lock lock(mutex);
+    if (auto it = gauges.find(name); it != gauges.end()) {
+        it->second = value;
+    } else {
+        gauges.emplace(std::string(name), value);
+    }
+}
+
+std::string MetricsRegistry::exportText() const {
+    auto toMs = [](double ns) { return ns / 1'000'000.0; };
+    auto allocations = currentAllocations();
+
+    std::string text;
+    auto out = std::back_inserter(text);
+    std::format_to(out, "# Process\n");
+    std::format_to(out, "memory.resident_mb {:.1f}\n", currentResidentMemory() / 1048576.0);
+    std::format_to(out, "memory.peak_resident_mb {:.1f}\n", peakResidentMemory() / 1048576.0);
+    if (allocationCountingEnabled()) {
+        std::format_to(out, "allocations.count {}\n", allocations.count);
+        std::format_to(out, "allocations.bytes {}\n", allocations.bytes);
+        std::format_to(out, "allocations.live_bytes {}\n", allocations.liveBytes);
+    }
+
+    std::scoped_lock lock(mutex);
+    if (!gauges.empty()) {
+        std::format_to(out, "\n# Gauges\n");
+        for (const auto& [name, value] : gauges) {
+            std::format_to(out, "{} {}\n", name, value);
+        }
+    }
+    if (!counters.empty()) {
+        std::format_to(out, "\n# Counters\n");
+        for (const auto& [name, value] : counters) {
+            std::format_to(out, "{} {}\n", name, value->load(std::memory_order_relaxed));
+        }
+    }
+    if (!histograms.empty()) {
+        std::format_to(out, "\n# Latency (ms)\n");
+        std::format_to(out, "{:<24} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}\n", "operation",
+                       "count", "mean", "p50", "p90", "p99", "max");
+        for (const auto& [name, histogram] : histograms) {
+            std::format_to(out, "{:<24} {:>8} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+                           name, histogram->count(), toMs(histogram->mean()),
+                           toMs(histogram->percentile(50)), toMs(histogram->percentile(90)),
+                           toMs(histogram->percentile(99)), toMs(histogram->max()));
+        }
+    }
+    return text;
+}
+
+void MetricsRegistry::reset() {
+    std::scoped_lock lock(mutex);
+    for (auto& [name, value] : counters) {
+        value->store(0, std::memory_order_relaxed);
+    }
+    for (auto& [name, histogram] : histograms) {
+        histogram->reset();
+    }
+}
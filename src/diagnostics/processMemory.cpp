@@ -0,0 +1,49 @@
+#include "diagnostics/processMemory.h"
+
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace {
+#ifndef _WIN32
+std::size_t readStatusField(std::string_view field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field)) {
+            return std::stoull(line.substr(field.size())) * 1024;
+        }
+    }
+    return 0;
+}
+#endif
+}
+
+std::size_t currentResidentMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#else
+    return readStatusField("VmRSS:");
+#endif
+}
+
+std::size_t peakResidentMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    return readStatusField("VmHWM:");
+#endif
+}
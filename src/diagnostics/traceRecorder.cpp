@@ -0,0 +1,152 @@
+#include "diagnostics/traceRecorder.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+
+std::atomic<bool> TraceRecorder::enabled{false};
+
+namespace {
+std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+}
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+
+std::uint64_t TraceRecorder::now() {
+    auto elapsed = std::chrono::steady_clock::now() - instance().epoch;
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return static_cast<std::uint64_t>(ns) + 1;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::scoped_lock lock(registryMutex);
+        buffer->threadId = static_cast<std::uint32_t>(buffers.size() + 1);
+        buffer->threadName = std::format("thread {}", buffer->threadId);
+        buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void TraceRecorder::record(const char* name, const char* category, std::uint64_t startNs,
+                           std::uint64_t endNs) {
+    auto& buffer = localBuffer();
+    if (!buffer.slots) {
+        auto slots = std::make_unique<Slot[]>(kEventsPerThread);
+        std::scoped_lock lock(registryMutex);
+        buffer.slots = std::move(slots);
+    }
+
+    // Per-slot seqlock: odd while the owning thread writes, 2 * index + 2 once event
+    // `index` is complete. Readers keep a slot only if the sequence is unchanged.
+    std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    Slot& slot = buffer.slots[head % kEventsPerThread];
+    slot.sequence.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(endNs > startNs ? endNs - startNs : 0, std::memory_order_relaxed);
+    slot.sequence.store(2 * head + 2, std::memory_order_release);
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TraceRecorder::setThreadName(std::string name) {
+    auto& buffer = localBuffer();
+    std::scoped_lock lock(registryMutex);
+    buffer.threadName = std::move(name);
+}
+
+std::vector<TraceEvent> TraceRecorder::snapshot(const ThreadBuffer& buffer) {
+    std::vector<TraceEvent> events;
+    if (!buffer.slots) return events;
+
+    std::uint64_t head = buffer.head.load(std::memory_order_acquire);
+    std::uint64_t first = std::max(buffer.floor.load(std::memory_order_relaxed),
+                                   head > kEventsPerThread ? head - kEventsPerThread : 0);
+    events.reserve(head - first);
+    for (std::uint64_t i = first; i < head; ++i) {
+        const Slot& slot = buffer.slots[i % kEventsPerThread];
+        const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * i + 2) continue;
+        TraceEvent event{slot.name.load(std::memory_order_relaxed),
+                         slot.category.load(std::memory_order_relaxed),
+                         slot.startNs.load(std::memory_order_relaxed),
+                         slot.durationNs.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+        events.push_back(event);
+    }
+    return events;
+}
+
+std::vector<TraceEvent> TraceRecorder::collect() const {
+    std::vector<TraceEvent> events;
+    std::scoped_lock lock(registryMutex);
+    for (const auto& buffer : buffers) {
+        auto threadEvents = snapshot(*buffer);
+        events.insert(events.end(), threadEvents.begin(), threadEvents.end());
+    }
+    return events;
+}
+
+bool TraceRecorder::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    auto separator = [&first]() {
+        const char* text = first ? "  " : ",\n  ";
+        first = false;
+        return text;
+    };
+
+    std::scoped_lock lock(registryMutex);
+    for (const auto& buffer : buffers) {
+        file << separator()
+             << std::format("{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": {}, "
+                            "\"args\": {{\"name\": \"{}\"}}}}",
+                            buffer->threadId, escapeJson(buffer->threadName));
+
+        for (const auto& event : snapshot(*buffer)) {
+            if (!event.name) continue;
+            file << separator()
+                 << std::format("{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"pid\": 1, "
+                                "\"tid\": {}, \"ts\": {:.3f}, \"dur\": {:.3f}}}",
+                                escapeJson(event.name),
+                                escapeJson(event.category ? event.category : "app"),
+                                buffer->threadId, event.startNs / 1000.0,
+                                event.durationNs / 1000.0);
+        }
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+void TraceRecorder::clear() {
+    std::scoped_lock lock(registryMutex);
+    for (const auto& buffer : buffers) {
+        buffer->floor.store(buffer->head.load(std::memory_order_acquire),
+                            std::memory_order_relaxed);
+    }
+}
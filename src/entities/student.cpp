@@ -3,38 +3,93 @@
 #include <format>
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 #include "exceptions/exceptions.h"
 #include "services/scholarshipCalculator.h"
 
-Student::Student(std::string_view name, std::string_view surname, int course, int semester,
-                 double averageGrade, bool isBudget)
+Student::Student(Unchecked, std::string_view name, std::string_view surname, int course,
+                 int semester, double averageGrade, bool isBudget)
     : name(name),
       surname(surname),
       course(course),
       semester(semester),
       averageGrade(averageGrade),
       isBudget(isBudget) {
-    if (name.empty() || surname.empty()) {
-        throw EmptyNameException();
+    scholarship = 0.0;
+    if (isBudget) {
+        budgetSemester = 1;
     }
+}
 
-    if (course < 1 || course > 4) {
-        throw InvalidCourseException(course);
+Student::Student(std::string_view name, std::string_view surname, int course, int semester,
+                 double averageGrade, bool isBudget)
+    : Student(Unchecked{}, name, surname, course, semester, averageGrade, isBudget) {
+    if (auto valid = validate(name, surname, course, semester, averageGrade); !valid) {
+        switch (valid.error().field) {
+            case StudentValidationError::Field::Name:
+            case StudentValidationError::Field::Surname:
+                throw EmptyNameException();
+            case StudentValidationError::Field::Course:
+                throw InvalidCourseException(course);
+            case StudentValidationError::Field::Semester:
+                throw InvalidSemesterException(semester);
+            case StudentValidationError::Field::AverageGrade:
+                throw InvalidGradeException(averageGrade);
+        }
     }
+}
 
+std::string_view StudentValidationError::fieldName() const {
+    switch (field) {
+        case Field::Name:
+            return "Name";
+        case Field::Surname:
+            return "Surname";
+        case Field::Course:
+            return "Course";
+        case Field::Semester:
+            return "Semester";
+        case Field::AverageGrade:
+            return "Avg Grade";
+    }
+    return "";
+}
+
+std::expected<void, StudentValidationError> Student::validate(std::string_view name,
+                                                              std::string_view surname,
+                                                              int course, int semester,
+                                                              double averageGrade) {
+    using enum StudentValidationError::Field;
+    if (name.empty()) {
+        return std::unexpected(StudentValidationError{Name, "must not be empty"});
+    }
+    if (surname.empty()) {
+        return std::unexpected(StudentValidationError{Surname, "must not be empty"});
+    }
+    if (course < 1 || course > 4) {
+        return std::unexpected(
+            StudentValidationError{Course, std::format("{} is not between 1 and 4", course)});
+    }
     if (semester < 1 || semester > 8) {
-        throw InvalidSemesterException(semester);
+        return std::unexpected(
+            StudentValidationError{Semester, std::format("{} is not between 1 and 8", semester)});
     }
-
-    if (averageGrade < 0.0 || averageGrade > 10.0) {
-        throw InvalidGradeException(averageGrade);
+    if (!(averageGrade >= 0.0 && averageGrade <= 10.0)) {
+        return std::unexpected(StudentValidationError{
+            AverageGrade, std::format("{} is not between 0.0 and 10.0", averageGrade)});
     }
+    return {};
+}
 
-    scholarship = 0.0;
-    if (isBudget) {
-        budgetSemester = 1;
+std::expected<std::shared_ptr<Student>, StudentValidationError> Student::create(
+    std::string_view name, std::string_view surname, int course, int semester,
+    double averageGrade, bool isBudget) {
+    if (auto valid = validate(name, surname, course, semester, averageGrade); !valid) {
+        return std::unexpected(std::move(valid.error()));
     }
+    return std::shared_ptr<Student>(
+        new Student(Unchecked{}, name, surname, course, semester, averageGrade, isBudget));
 }
 
 double Student::calculateAverageGrade() const { return averageGrade; }
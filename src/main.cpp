@@ -2,10 +2,18 @@
 #include <QCoreApplication>
 #include <QStyleFactory>
 
+#include "diagnostics/traceRecorder.h"
+#include "services/taskScheduler.h"
 #include "ui/mainWindow.h"
 
 
 int main(int argc, char* argv[]) {
+    const QByteArray tracePath = qgetenv("SCHOLAR_TRACE");
+    if (!tracePath.isEmpty()) {
+        TraceRecorder::instance().setEnabled(true);
+    }
+    TraceRecorder::instance().setThreadName("GUI");
+
     QApplication app(argc, argv);
 
     QCoreApplication::setApplicationName("Scholarship Management System");
@@ -14,8 +22,16 @@ int main(int argc, char* argv[]) {
 
     QApplication::setStyle(QStyleFactory::create("Fusion"));
 
+    TaskScheduler::instance().setMainThreadDispatcher([](TaskScheduler::MainThreadTask task) {
+        QMetaObject::invokeMethod(qApp, std::move(task), Qt::QueuedConnection);
+    });
+
     MainWindow window;
     window.show();
 
-    return QApplication::exec();
+    int result = QApplication::exec();
+    if (!tracePath.isEmpty()) {
+        TraceRecorder::instance().writeChromeTrace(tracePath.toStdString());
+    }
+    return result;
 }
\ No newline at end of file
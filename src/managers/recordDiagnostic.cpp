@@ -0,0 +1,27 @@
+#include "managers/recordDiagnostic.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+
+std::string RecordDiagnostic::toString() const {
+    std::string text = std::format("line {}", line);
+    if (!record.empty()) {
+        text += std::format(" ({})", record);
+    }
+    return std::format("{}: {}: {}", text, field, reason);
+}
+
+std::string LoadReport::describe(std::size_t limit) const {
+    std::string text;
+    const std::size_t shown = std::min(limit, diagnostics.size());
+    for (std::size_t i = 0; i < shown; ++i) {
+        std::format_to(std::back_inserter(text), "{}{}", i > 0 ? "\n" : "",
+                       diagnostics[i].toString());
+    }
+    if (shown < diagnostics.size()) {
+        std::format_to(std::back_inserter(text), "\n... and {} more",
+                       diagnostics.size() - shown);
+    }
+    return text;
+}
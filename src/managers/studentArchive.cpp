@@ -0,0 +1,306 @@
+#include "managers/studentArchive.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "diagnostics/traceRecorder.h"
+#include "exceptions/exceptions.h"
+#include "managers/studentDatabase.h"
+#include "managers/studentTransaction.h"
+#include "services/historyGradeGenerator.h"
+
+namespace {
+constexpr std::string_view kArchiveHeader =
+    "# Scholarship Management System - Student Archive v1\n";
+constexpr std::size_t kFieldCount = 11;
+
+void appendHistory(std::string& out, const std::map<int, double>& history) {
+    bool first = true;
+    for (const auto& [semester, value] : history) {
+        std::format_to(std::back_inserter(out), "{}{}:{:.2f}", first ? "" : ";", semester, value);
+        first = false;
+    }
+}
+
+template <typename T>
+bool parseNumber(std::string_view text, T& value) {
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc() && end == text.data() + text.size();
+}
+
+template <typename Add>
+bool parseHistory(std::string_view text, Add add) {
+    while (!text.empty()) {
+        const auto separator = text.find(';');
+        const auto entry = text.substr(0, separator);
+        const auto colon = entry.find(':');
+        int semester = 0;
+        double value = 0.0;
+        if (colon == std::string_view::npos || !parseNumber(entry.substr(0, colon), semester) ||
+            !parseNumber(entry.substr(colon + 1), value)) {
+            return false;
+        }
+        add(semester, value);
+        text.remove_prefix(separator == std::string_view::npos ? text.size() : separator + 1);
+    }
+    return true;
+}
+
+bool parseDate(std::string_view text, std::chrono::sys_days& date) {
+    int year = 0;
+    unsigned month = 0;
+    unsigned day = 0;
+    if (text.size() != 10 || text[4] != '-' || text[7] != '-' ||
+        !parseNumber(text.substr(0, 4), year) || !parseNumber(text.substr(5, 2), month) ||
+        !parseNumber(text.substr(8, 2), day)) {
+        return false;
+    }
+    const std::chrono::year_month_day ymd{std::chrono::year(year), std::chrono::month(month),
+                                          std::chrono::day(day)};
+    if (!ymd.ok()) return false;
+    date = ymd;
+    return true;
+}
+}
+
+StudentArchive::StudentArchive(std::string_view filename) : filename(filename) {}
+
+std::string StudentArchive::getFilename() const {
+    std::scoped_lock lock(mutex);
+    return filename;
+}
+
+void StudentArchive::setFilename(std::string_view newFilename) {
+    std::scoped_lock lock(mutex);
+    filename = newFilename;
+    loaded = false;
+    students.clear();
+}
+
+std::string StudentArchive::filenameFor(std::string_view databaseFilename) {
+    return std::filesystem::path(databaseFilename).replace_extension(".archive").string();
+}
+
+void StudentArchive::appendRecord(std::string& out, const Student& s,
+                                  std::chrono::sys_days archivedOn) {
+    const std::chrono::year_month_day date(archivedOn);
+    auto it = std::back_inserter(out);
+    std::format_to(it, "{:04}-{:02}-{:02}\t", static_cast<int>(date.year()),
+                   static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+    std::format_to(it, "{}\t{}\t{}\t{:.2f}\t{}\t{}\t{}\t{:.2f}\t", s.getSurname(), s.getName(),
+                   s.getSemester(), s.getAverageGrade(), s.getIsBudget() ? 'B' : 'P',
+                   s.getMissedHours(), s.getHasSocialScholarship() ? 1 : 0, s.getScholarship());
+    appendHistory(out, s.getPreviousSemesterGrades());
+    out += '\t';
+    appendHistory(out, s.getPreviousSemesterScholarships());
+    out += '\n';
+}
+
+std::expected<ArchivedStudent, RecordDiagnostic> StudentArchive::parseRecord(
+    std::string_view line) {
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    auto invalid = [](std::string_view field, std::string reason) {
+        return std::unexpected(RecordDiagnostic{0, {}, std::string(field), std::move(reason)});
+    };
+
+    std::array<std::string_view, kFieldCount> fields;
+    std::size_t count = 0;
+    for (std::size_t start = 0;;) {
+        const auto tab = line.find('\t', start);
+        if (count == kFieldCount) {
+            return invalid("Record", std::format("more than {} fields", kFieldCount));
+        }
+        fields[count++] = line.substr(start, tab == std::string_view::npos ? tab : tab - start);
+        if (tab == std::string_view::npos) break;
+        start = tab + 1;
+    }
+    if (count != kFieldCount) {
+        return invalid("Record", std::format("{} of {} fields", count, kFieldCount));
+    }
+
+    ArchivedStudent record;
+    int semester = 0;
+    int missedHours = 0;
+    int social = 0;
+    double averageGrade = 0.0;
+    double scholarship = 0.0;
+    const auto& funding = fields[5];
+    if (!parseDate(fields[0], record.archivedOn)) {
+        return invalid("Archived", std::format("'{}' is not a date", fields[0]));
+    }
+    if (!parseNumber(fields[3], semester)) {
+        return invalid("Semester", std::format("'{}' is not a number", fields[3]));
+    }
+    if (!parseNumber(fields[4], averageGrade)) {
+        return invalid("Avg Grade", std::format("'{}' is not a number", fields[4]));
+    }
+    if (funding != "B" && funding != "P") {
+        return invalid("Funding", std::format("'{}' is not B or P", funding));
+    }
+    if (!parseNumber(fields[6], missedHours) || !parseNumber(fields[7], social) ||
+        !parseNumber(fields[8], scholarship)) {
+        return invalid("Record", "missed hours, social flag or scholarship is not a number");
+    }
+
+    auto created = Student::create(fields[2], fields[1], std::clamp((semester - 1) / 2 + 1, 1, 4),
+                                   semester, averageGrade, funding == "B");
+    if (!created) {
+        return invalid(created.error().fieldName(), std::move(created.error().reason));
+    }
+    auto student = std::move(*created);
+    student->setMissedHours(missedHours);
+    student->setHasSocialScholarship(social != 0);
+    student->setScholarship(scholarship);
+    auto addGrade = [&student](int sem, double grade) { student->addPreviousGrade(sem, grade); };
+    auto addScholarship = [&student](int sem, double amount) {
+        student->addPreviousScholarship(sem, amount);
+    };
+    if (!parseHistory(fields[9], addGrade)) {
+        return invalid("Previous", std::format("'{}' is not a semester:grade list", fields[9]));
+    }
+    if (!parseHistory(fields[10], addScholarship)) {
+        return invalid("Scholarships",
+                       std::format("'{}' is not a semester:amount list", fields[10]));
+    }
+    student->setHistoryMaterialized(true);
+    record.student = std::move(student);
+    return record;
+}
+
+void StudentArchive::append(const std::vector<std::shared_ptr<Student>>& batch) {
+    append(batch, std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now()));
+}
+
+void StudentArchive::append(const std::vector<std::shared_ptr<Student>>& batch,
+                            std::chrono::sys_days archivedOn) {
+    TRACE_SCOPE("StudentArchive::append", "database");
+    if (batch.empty()) return;
+
+    std::scoped_lock lock(mutex);
+    appendLocked(batch, archivedOn);
+}
+
+std::uintmax_t StudentArchive::appendLocked(const std::vector<std::shared_ptr<Student>>& batch,
+                                            std::chrono::sys_days archivedOn) {
+    std::error_code sizeError;
+    std::uintmax_t previousSize = std::filesystem::file_size(filename, sizeError);
+    if (sizeError) previousSize = 0;
+    std::string records(previousSize == 0 ? kArchiveHeader : "");
+    for (const auto& student : batch) {
+        appendRecord(records, *student, archivedOn);
+    }
+
+    std::ofstream file(filename, std::ios::app | std::ios::binary);
+    file.write(records.data(), static_cast<std::streamsize>(records.size()));
+    if (!file.flush()) {
+        file.close();
+        std::filesystem::resize_file(filename, previousSize, sizeError);
+        throw FileWriteException(filename);
+    }
+
+    if (loaded) {
+        for (const auto& student : batch) {
+            students.push_back(ArchivedStudent{std::make_shared<Student>(*student), archivedOn});
+        }
+    }
+    return previousSize;
+}
+
+void StudentArchive::moveFrom(StudentDatabase& database,
+                              const std::vector<std::shared_ptr<Student>>& batch,
+                              const HistoryGradeGenerator& generator) {
+    TRACE_SCOPE("StudentArchive::moveFrom", "database");
+    if (batch.empty()) return;
+
+    std::vector<std::shared_ptr<Student>> records;
+    records.reserve(batch.size());
+    StudentTransaction transaction;
+    for (const auto& student : batch) {
+        auto record = std::make_shared<Student>(*student);
+        generator.materializeHistory(*record);
+        records.push_back(std::move(record));
+        transaction.remove(student);
+    }
+
+    const auto today = std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+    std::scoped_lock lock(mutex);
+    const std::uintmax_t previousSize = appendLocked(records, today);
+    try {
+        database.commit(transaction);
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::resize_file(filename, previousSize, ignored);
+        if (loaded) {
+            students.resize(students.size() - records.size());
+        }
+        throw;
+    }
+}
+
+bool StudentArchive::isLoaded() const {
+    std::scoped_lock lock(mutex);
+    return loaded;
+}
+
+LoadReport StudentArchive::load() {
+    std::scoped_lock lock(mutex);
+    return loadLocked();
+}
+
+LoadReport StudentArchive::loadLocked() {
+    LoadReport report;
+    if (loaded) return report;
+    TRACE_SCOPE("StudentArchive::load", "database");
+    std::ifstream file(filename, std::ios::binary);
+    loaded = true;
+    if (!file.is_open()) return report;
+    report.opened = true;
+
+    std::string line;
+    for (std::size_t lineNumber = 1; std::getline(file, line); ++lineNumber) {
+        if (line.empty() || line.starts_with('#')) continue;
+        auto record = parseRecord(line);
+        if (!record) {
+            record.error().line = lineNumber;
+            report.diagnostics.push_back(std::move(record.error()));
+            continue;
+        }
+        students.push_back(std::move(*record));
+        ++report.accepted;
+    }
+    return report;
+}
+
+std::vector<ArchivedStudent> StudentArchive::records() {
+    std::scoped_lock lock(mutex);
+    loadLocked();
+    return students;
+}
+
+std::size_t StudentArchive::size() {
+    std::scoped_lock lock(mutex);
+    loadLocked();
+    return students.size();
+}
+
+std::map<int, StudentArchive::YearSummary> StudentArchive::summarizeByYear() {
+    TRACE_SCOPE("StudentArchive::summarizeByYear", "statistics");
+    std::scoped_lock lock(mutex);
+    loadLocked();
+    std::map<int, YearSummary> years;
+    for (const auto& [student, archivedOn] : students) {
+        auto& summary = years[static_cast<int>(std::chrono::year_month_day(archivedOn).year())];
+        ++summary.students;
+        ++(student->getIsBudget() ? summary.budget : summary.paid);
+        for (const auto& [semester, amount] : student->getPreviousSemesterScholarships()) {
+            summary.totalScholarships += amount;
+        }
+    }
+    return years;
+}
@@ -0,0 +1,196 @@
+#include "managers/studentChangeFeed.h"
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
+#include "diagnostics/traceRecorder.h"
+#include "services/taskScheduler.h"
+
+StudentFieldState::StudentFieldState(const Student& student)
+    : values{student.getName(),
+             student.getSurname(),
+             student.getCourse(),
+             student.getSemester(),
+             student.getAverageGrade(),
+             student.getIsBudget(),
+             student.getMissedHours(),
+             student.getHasSocialScholarship(),
+             student.getScholarship(),
+             static_cast<int>(student.getPreviousSemesterGrades().size() +
+                              student.getPreviousSemesterScholarships().size())} {}
+
+StudentChangeFeed::~StudentChangeFeed() {
+    for (Node* node = head.exchange(nullptr); node;) {
+        std::unique_ptr<Node> owned(node);
+        node = node->next;
+    }
+}
+
+std::size_t StudentChangeFeed::subscribe(Subscriber subscriber) {
+    const std::size_t id = nextSubscriberId++;
+    subscribers.emplace_back(id, std::move(subscriber));
+    subscriberCount.store(subscribers.size(), std::memory_order_release);
+    return id;
+}
+
+void StudentChangeFeed::unsubscribe(std::size_t id) {
+    std::erase_if(subscribers, [id](const auto& entry) { return entry.first == id; });
+    subscriberCount.store(subscribers.size(), std::memory_order_release);
+}
+
+bool StudentChangeFeed::enqueue(Batch changes, std::uint64_t sequence) {
+    if (changes.empty() || !hasSubscribers()) return false;
+
+    auto* node = new Node{sequence, std::move(changes)};
+    node->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
+    return node->next == nullptr;
+}
+
+void StudentChangeFeed::scheduleFlush() {
+    TaskScheduler::instance().postToMainThread([this]() { flush(); });
+}
+
+void StudentChangeFeed::flush() {
+    TRACE_SCOPE("StudentChangeFeed::flush", "database");
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (Node* node = head.exchange(nullptr, std::memory_order_acquire); node;) {
+        Node* next = node->next;
+        nodes.emplace_back(node);
+        node = next;
+    }
+    if (nodes.empty()) return;
+
+    std::ranges::sort(nodes, {}, [](const std::unique_ptr<Node>& node) { return node->sequence; });
+    Batch changes;
+    for (auto& node : nodes) {
+        changes.insert(changes.end(), std::make_move_iterator(node->changes.begin()),
+                       std::make_move_iterator(node->changes.end()));
+    }
+    changes = coalesce(std::move(changes));
+    if (changes.empty()) return;
+
+    const auto current = subscribers;
+    for (const auto& [id, subscriber] : current) {
+        subscriber(changes);
+    }
+}
+
+void StudentChangeFeed::diff(const StudentFieldState& before,
+                             const std::shared_ptr<Student>& previous,
+                             const std::shared_ptr<Student>& current, Batch& out) {
+    const StudentFieldState after(*current);
+    const std::size_t first = out.size();
+    for (std::size_t i = 0; i < kStudentFieldCount; ++i) {
+        const auto field = static_cast<StudentField>(i);
+        if (before[field] != after[field]) {
+            out.push_back(StudentChange{StudentChange::Kind::FieldChanged, current, previous, field,
+                                        before[field], after[field]});
+        }
+    }
+    if (out.size() == first && previous != current) {
+        out.push_back(StudentChange{StudentChange::Kind::Replaced, current, previous});
+    }
+}
+
+StudentChangeFeed::Batch StudentChangeFeed::coalesce(Batch changes) {
+    struct FieldDelta {
+        StudentField field;
+        StudentFieldValue oldValue;
+        StudentFieldValue newValue;
+    };
+    struct Entry {
+        std::shared_ptr<Student> origin;
+        std::shared_ptr<Student> current;
+        bool added = false;
+        bool removed = false;
+        std::vector<FieldDelta> fields{};
+    };
+
+    using enum StudentChange::Kind;
+    std::vector<Entry> entries;
+    std::unordered_map<const Student*, std::size_t> live;
+    for (auto& change : changes) {
+        if (change.kind == Added) {
+            live[change.student.get()] = entries.size();
+            entries.push_back(Entry{change.student, change.student, true});
+            continue;
+        }
+
+        const auto& known = change.kind == Removed ? change.student : change.previous;
+        std::size_t index = entries.size();
+        if (auto it = live.find(known.get()); it != live.end()) {
+            index = it->second;
+            live.erase(it);
+        } else {
+            entries.push_back(Entry{known, known});
+        }
+
+        Entry& entry = entries[index];
+        if (change.kind == Removed) {
+            entry.removed = true;
+            continue;
+        }
+        entry.current = change.student;
+        live[change.student.get()] = index;
+        if (change.kind == FieldChanged) {
+            auto delta = std::ranges::find(entry.fields, change.field, &FieldDelta::field);
+            if (delta == entry.fields.end()) {
+                entry.fields.push_back(FieldDelta{change.field, std::move(change.oldValue),
+                                                  std::move(change.newValue)});
+            } else {
+                delta->newValue = std::move(change.newValue);
+            }
+        }
+    }
+
+    Batch result;
+    for (auto& entry : entries) {
+        if (entry.added) {
+            if (!entry.removed) result.push_back(StudentChange{Added, entry.current});
+            continue;
+        }
+        if (entry.removed) {
+            result.push_back(StudentChange{Removed, entry.origin});
+            continue;
+        }
+        const std::size_t first = result.size();
+        for (auto& delta : entry.fields) {
+            if (delta.oldValue != delta.newValue) {
+                result.push_back(StudentChange{FieldChanged, entry.current, entry.origin,
+                                               delta.field, std::move(delta.oldValue),
+                                               std::move(delta.newValue)});
+            }
+        }
+        if (result.size() == first && entry.current != entry.origin) {
+            result.push_back(StudentChange{Replaced, entry.current, entry.origin});
+        }
+    }
+    return result;
+}
+
+StudentChangeSet StudentChangeFeed::summarize(const Batch& changes) {
+    StudentChangeSet summary;
+    const Student* lastUpdated = nullptr;
+    for (const auto& change : changes) {
+        switch (change.kind) {
+            case StudentChange::Kind::Added:
+                summary.added.push_back(change.student);
+                break;
+            case StudentChange::Kind::Removed:
+                summary.removed.push_back(change.student);
+                break;
+            case StudentChange::Kind::FieldChanged:
+            case StudentChange::Kind::Replaced:
+                if (change.previous.get() != lastUpdated) {
+                    summary.updated.push_back({change.previous, change.student});
+                    lastUpdated = change.previous.get();
+                }
+                break;
+        }
+    }
+    return summary;
+}
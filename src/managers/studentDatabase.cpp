@@ -1,70 +1,173 @@
 #include "managers/studentDatabase.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <ctime>
+#include <expected>
+#include <filesystem>
 #include <format>
 #include <fstream>
 #include <functional>
 #include <iomanip>
+#include <iterator>
+#include <mutex>
 #include <ranges>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
+#include "diagnostics/memoryFootprint.h"
+#include "diagnostics/traceRecorder.h"
 #include "exceptions/exceptions.h"
+#include "services/historyGradeGenerator.h"
+
+namespace {
+    StudentChange addedChange(const std::shared_ptr<Student>& student) {
+        return StudentChange{StudentChange::Kind::Added, student};
+    }
+
+    StudentChange removedChange(const std::shared_ptr<Student>& student) {
+        return StudentChange{StudentChange::Kind::Removed, student};
+    }
+}
 
 void StudentDatabase::addStudent(std::shared_ptr<Student> student) {
     if (student != nullptr) {
-        students.push_back(student);
+        bool flushPending = false;
+        {
+            auto lock = lockForWrite();
+            students.pushBack(student);
+            flushPending = publishLocked({addedChange(student)});
+        }
+        if (flushPending) feed.scheduleFlush();
     }
 }
 
-void StudentDatabase::addStudent(std::string_view name, std::string_view surname, int course,
-                                 int semester, double averageGrade, bool isBudget) {
-    for (const auto& existing : students) {
-        if (existing->getName() == name && existing->getSurname() == surname) {
-            throw DuplicateStudentException(std::format("{} {}", surname, name));
+void StudentDatabase::addStudents(const std::vector<std::shared_ptr<Student>>& batch) {
+    StudentChangeFeed::Batch changes;
+    changes.reserve(batch.size());
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        for (const auto& student : batch) {
+            if (student != nullptr) {
+                students.pushBack(student);
+                changes.push_back(addedChange(student));
+            }
         }
+        flushPending = publishLocked(std::move(changes));
     }
+    if (flushPending) feed.scheduleFlush();
+}
 
+void StudentDatabase::addStudent(std::string_view name, std::string_view surname, int course,
+                                 int semester, double averageGrade, bool isBudget) {
     auto student =
         std::make_shared<Student>(name, surname, course, semester, averageGrade, isBudget);
-    students.push_back(student);
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        students.snapshot().forEach([&name, &surname](const std::shared_ptr<Student>& existing) {
+            if (existing->getName() == name && existing->getSurname() == surname) {
+                throw DuplicateStudentException(std::format("{} {}", surname, name));
+            }
+        });
+        students.pushBack(student);
+        flushPending = publishLocked({addedChange(student)});
+    }
+    if (flushPending) feed.scheduleFlush();
 }
 
 bool StudentDatabase::removeStudent(std::string_view name, std::string_view surname) {
-    auto [first, last] = std::ranges::remove_if(students,
-                                                [&name, &surname](const std::shared_ptr<Student>& student) {
-                                                    return student->getName() == name && student->getSurname() == surname;
-                                                });
-
-    if (first != last) {
-        students.erase(first, last);
-        return true;
+    std::vector<std::shared_ptr<Student>> removed;
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        removed = students.eraseIf([&name, &surname](const std::shared_ptr<Student>& student) {
+            return student->getName() == name && student->getSurname() == surname;
+        });
+        StudentChangeFeed::Batch changes;
+        std::ranges::transform(removed, std::back_inserter(changes), removedChange);
+        flushPending = publishLocked(std::move(changes));
     }
-    return false;
+    if (flushPending) feed.scheduleFlush();
+    return !removed.empty();
 }
 
 bool StudentDatabase::removeStudent(size_t index) {
-    if (index < students.size()) {
-        students.erase(students.begin() + index);
-        return true;
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        if (index >= students.size()) {
+            return false;
+        }
+        auto removed = students[index];
+        students.erase(index);
+        flushPending = publishLocked({removedChange(removed)});
     }
-    return false;
+    if (flushPending) feed.scheduleFlush();
+    return true;
 }
 
 bool StudentDatabase::removeStudentPtr(const std::shared_ptr<Student>& studentPtr) {
-    if (auto it = std::ranges::find(students, studentPtr); it != students.end()) {
-        students.erase(it);
-        return true;
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        auto index = students.find(studentPtr);
+        if (!index) {
+            return false;
+        }
+        students.erase(*index);
+        flushPending = publishLocked({removedChange(studentPtr)});
     }
-    return false;
+    if (flushPending) feed.scheduleFlush();
+    return true;
+}
+
+bool StudentDatabase::publishLocked(StudentChangeFeed::Batch changes) {
+    return feed.enqueue(std::move(changes), ++changeSequence);
+}
+
+std::shared_lock<std::shared_mutex> StudentDatabase::lockForRead() const {
+    for (int writers = pendingWriters.load(); writers > 0; writers = pendingWriters.load()) {
+        pendingWriters.wait(writers);
+    }
+    return std::shared_lock(mutex);
+}
+
+std::unique_lock<std::shared_mutex> StudentDatabase::lockForWrite() {
+    pendingWriters.fetch_add(1);
+    std::unique_lock lock(mutex);
+    if (pendingWriters.fetch_sub(1) == 1) {
+        pendingWriters.notify_all();
+    }
+    return lock;
+}
+
+StudentDatabase::Snapshot StudentDatabase::snapshot() const {
+    auto lock = lockForRead();
+    return students.snapshot();
+}
+
+std::vector<std::shared_ptr<Student>> StudentDatabase::getAllStudents() const {
+    return snapshot().toVector();
+}
+
+size_t StudentDatabase::getStudentCount() const {
+    auto lock = lockForRead();
+    return students.size();
 }
 
 std::shared_ptr<Student> StudentDatabase::getStudent(size_t index) const {
+    auto lock = lockForRead();
     if (index < students.size()) {
         return students[index];
     }
@@ -79,6 +182,7 @@ std::string toLower(std::string_view str) {
 }
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchByName(std::string_view name) const {
+    TRACE_SCOPE("StudentDatabase::searchByName", "database");
     std::string lowerName = toLower(name);
     return searchStudents([&lowerName](const std::shared_ptr<Student>& student) {
         return toLower(student->getName()).contains(lowerName) ||
@@ -88,6 +192,7 @@ std::vector<std::shared_ptr<Student>> StudentDatabase::searchByName(std::string_
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchBySurname(
     std::string_view surname) const {
+    TRACE_SCOPE("StudentDatabase::searchBySurname", "database");
     std::string lowerSurname = toLower(surname);
     return searchStudents([&lowerSurname](const std::shared_ptr<Student>& student) {
         return toLower(student->getSurname()).contains(lowerSurname);
@@ -96,6 +201,7 @@ std::vector<std::shared_ptr<Student>> StudentDatabase::searchBySurname(
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageGrade(double minGrade,
                                                                             double maxGrade) const {
+    TRACE_SCOPE("StudentDatabase::searchByAverageGrade", "database");
     return searchStudents([minGrade, maxGrade](const std::shared_ptr<Student>& student) {
         double avg = student->calculateAverageGrade();
         return avg >= minGrade && avg <= maxGrade;
@@ -104,6 +210,7 @@ std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageGrade(doub
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageAtLeast(
     double minGrade) const {
+    TRACE_SCOPE("StudentDatabase::searchByAverageAtLeast", "database");
     return searchStudents([minGrade](const std::shared_ptr<Student>& student) {
         return student->calculateAverageGrade() >= minGrade;
     });
@@ -111,6 +218,7 @@ std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageAtLeast(
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageEqual(
     double exactGrade) const {
+    TRACE_SCOPE("StudentDatabase::searchByAverageEqual", "database");
     auto round2 = [](double v) { return std::round(v * 100.0) / 100.0; };
     double target = round2(exactGrade);
     return searchStudents([target, round2](const std::shared_ptr<Student>& student) {
@@ -119,15 +227,364 @@ std::vector<std::shared_ptr<Student>> StudentDatabase::searchByAverageEqual(
 }
 
 std::vector<std::shared_ptr<Student>> StudentDatabase::searchByCourse(int course) const {
+    TRACE_SCOPE("StudentDatabase::searchByCourse", "database");
     return searchStudents([course](const std::shared_ptr<Student>& student) {
         return student->getCourse() == course;
     });
 }
 
-void StudentDatabase::clear() { students.clear(); }
+std::shared_ptr<Student> StudentDatabase::updateStudent(const std::shared_ptr<Student>& student,
+                                                        const StudentMutator& mutator) {
+    StudentChangeFeed::Batch changes;
+    std::shared_ptr<Student> current;
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        auto index = student ? students.find(student) : std::nullopt;
+        if (!index) {
+            return nullptr;
+        }
+        const StudentFieldState before(*student);
+        current = students.update(*index, mutator);
+        StudentChangeFeed::diff(before, student, current, changes);
+        flushPending = publishLocked(std::move(changes));
+    }
+    if (flushPending) feed.scheduleFlush();
+    return current;
+}
+
+bool StudentDatabase::updateMatchingLocked(const StudentStore::StudentFilter& filter,
+                                           const StudentMutator& mutator,
+                                           std::stop_token stopToken,
+                                           StudentChangeFeed::Batch& changes) {
+    const bool tracked = feed.hasSubscribers();
+    std::vector<StudentChangeFeed::Batch> partials(tracked ? students.chunkCount() : 0);
+    const bool completed = students.updateChunks(
+        filter,
+        [&](std::size_t chunk, const std::shared_ptr<Student>& previous,
+            const std::shared_ptr<Student>& current) {
+            if (!tracked) {
+                mutator(*current);
+                return;
+            }
+            const StudentFieldState before(*current);
+            mutator(*current);
+            StudentChangeFeed::diff(before, previous, current, partials[chunk]);
+        },
+        kParallelUpdateGrain, stopToken);
+
+    for (auto& partial : partials) {
+        changes.insert(changes.end(), std::make_move_iterator(partial.begin()),
+                       std::make_move_iterator(partial.end()));
+    }
+    return completed;
+}
+
+bool StudentDatabase::updateMatching(const StudentStore::StudentFilter& filter,
+                                     const StudentMutator& mutator, std::stop_token stopToken) {
+    StudentChangeFeed::Batch changes;
+    bool flushPending = false;
+    bool completed = false;
+    {
+        auto lock = lockForWrite();
+        completed = updateMatchingLocked(filter, mutator, stopToken, changes);
+        flushPending = publishLocked(std::move(changes));
+    }
+    if (flushPending) feed.scheduleFlush();
+    return completed;
+}
+
+bool StudentDatabase::updateAllStudents(const StudentMutator& mutator, std::stop_token stopToken) {
+    TRACE_SCOPE("StudentDatabase::updateAllStudents", "database");
+    return updateMatching(nullptr, mutator, stopToken);
+}
+
+bool StudentDatabase::materializeHistory(const HistoryGradeGenerator& generator,
+                                         std::stop_token stopToken) {
+    auto pending = [](const std::shared_ptr<Student>& student) {
+        return student && !student->isHistoryMaterialized();
+    };
+    bool anyPending = false;
+    snapshot().forEach([&](const std::shared_ptr<Student>& student) {
+        anyPending = anyPending || pending(student);
+    });
+    if (!anyPending) {
+        return true;
+    }
+    return updateMatching(
+        pending, [&generator](Student& student) { generator.materializeHistory(student); },
+        stopToken);
+}
+
+SemesterAdvance StudentDatabase::advanceSemester(const HistoryGradeGenerator& generator) {
+    TRACE_SCOPE("StudentDatabase::advanceSemester", "database");
+    SemesterAdvance result;
+    StudentChangeFeed::Batch changes;
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        result.graduated = students.eraseIf([](const std::shared_ptr<Student>& student) {
+            return student->getSemester() >= kFinalSemester;
+        });
+        std::ranges::transform(result.graduated, std::back_inserter(changes), removedChange);
+
+        result.advanced = students.size();
+        updateMatchingLocked(
+            nullptr,
+            [&generator](Student& student) {
+                const int semester = student.getSemester();
+                generator.materializeHistory(student);
+                student.addPreviousGrade(semester, student.getAverageGrade());
+                student.setSemester(semester + 1);
+                student.recalculateScholarship();
+            },
+            {}, changes);
+        flushPending = publishLocked(std::move(changes));
+    }
+    if (flushPending) feed.scheduleFlush();
+
+    for (auto& graduate : result.graduated) {
+        auto finished = std::make_shared<Student>(*graduate);
+        generator.materializeHistory(*finished);
+        finished->addPreviousGrade(finished->getSemester(), finished->getAverageGrade());
+        graduate = std::move(finished);
+    }
+    return result;
+}
+
+StudentChangeSet StudentDatabase::commit(const StudentTransaction& transaction) {
+    TRACE_SCOPE("StudentDatabase::commit", "database");
+    constexpr std::size_t kMissing = static_cast<std::size_t>(-1);
+    auto describe = [](const std::shared_ptr<Student>& student) {
+        return student ? std::format("{} {}", student->getSurname(), student->getName())
+                       : std::string("<null>");
+    };
+    auto nameKey = [](const Student& student) {
+        return student.getName() + '\n' + student.getSurname();
+    };
+
+    auto lock = lockForWrite();
+    std::unordered_map<const Student*, std::size_t> positions;
+    for (const auto& update : transaction.updates) {
+        positions.emplace(update.student.get(), kMissing);
+    }
+    for (const auto& student : transaction.removed) {
+        positions.emplace(student.get(), kMissing);
+    }
+
+    std::vector<std::string> problems;
+    if (!positions.empty()) {
+        std::size_t index = 0;
+        students.snapshot().forEach([&](const std::shared_ptr<Student>& student) {
+            if (auto it = positions.find(student.get()); it != positions.end()) {
+                it->second = index;
+            }
+            ++index;
+        });
+    }
+
+    std::unordered_set<const Student*> removed;
+    for (const auto& student : transaction.removed) {
+        if (!student || positions[student.get()] == kMissing) {
+            problems.push_back(std::format("Student not found: {}", describe(student)));
+        } else {
+            removed.insert(student.get());
+        }
+    }
+
+    StudentChangeSet changes;
+    std::unordered_map<const Student*, std::size_t> staged;
+    for (const auto& [student, mutator] : transaction.updates) {
+        if (!student || positions[student.get()] == kMissing) {
+            problems.push_back(std::format("Student not found: {}", describe(student)));
+            continue;
+        }
+        if (removed.contains(student.get())) {
+            problems.push_back(
+                std::format("{}: edited and deleted in the same change", describe(student)));
+            continue;
+        }
+        auto [it, inserted] = staged.try_emplace(student.get(), changes.updated.size());
+        if (inserted) {
+            changes.updated.push_back({student, std::make_shared<Student>(*student)});
+        }
+        try {
+            mutator(*changes.updated[it->second].current);
+        } catch (const ValidationException& e) {
+            problems.push_back(std::format("{}: {}", describe(student), e.what()));
+        }
+    }
+
+    std::unordered_set<const Student*> renamed;
+    std::unordered_set<std::string> incomingNames;
+    std::unordered_set<std::string> incomingSurnames;
+    for (const auto& [previous, current] : changes.updated) {
+        if (auto valid = Student::validate(current->getName(), current->getSurname(),
+                                           current->getCourse(), current->getSemester(),
+                                           current->getAverageGrade());
+            !valid) {
+            problems.push_back(std::format("{}: {} {}", describe(previous),
+                                           valid.error().fieldName(), valid.error().reason));
+        }
+        if (nameKey(*previous) == nameKey(*current)) continue;
+        renamed.insert(previous.get());
+        if (!incomingNames.insert(nameKey(*current)).second) {
+            problems.push_back(std::format("Student already exists: {}", describe(current)));
+        }
+        incomingSurnames.insert(current->getSurname());
+    }
+    for (const auto& student : transaction.added) {
+        if (!student) {
+            problems.push_back("Cannot add an empty student record");
+            continue;
+        }
+        if (!incomingNames.insert(nameKey(*student)).second) {
+            problems.push_back(std::format("Student added twice: {}", describe(student)));
+        }
+        incomingSurnames.insert(student->getSurname());
+    }
+
+    if (!incomingNames.empty()) {
+        students.snapshot().forEach([&](const std::shared_ptr<Student>& student) {
+            if (incomingSurnames.contains(student->getSurname()) &&
+                incomingNames.contains(nameKey(*student)) && !removed.contains(student.get()) &&
+                !renamed.contains(student.get())) {
+                problems.push_back(std::format("Student already exists: {}", describe(student)));
+            }
+        });
+    }
+
+    if (!problems.empty()) {
+        std::string details;
+        for (const auto& problem : problems) {
+            if (!details.empty()) details += '\n';
+            details += problem;
+        }
+        throw TransactionRejectedException(details);
+    }
+
+    for (const auto& [previous, current] : changes.updated) {
+        students.replace(positions[previous.get()], current);
+    }
+    std::vector<std::size_t> removedIndices;
+    removedIndices.reserve(removed.size());
+    for (const auto& student : transaction.removed) {
+        if (removed.erase(student.get())) {
+            removedIndices.push_back(positions[student.get()]);
+            changes.removed.push_back(student);
+        }
+    }
+    students.eraseAt(std::move(removedIndices));
+    for (const auto& student : transaction.added) {
+        students.pushBack(student);
+    }
+    changes.added = transaction.added;
+
+    StudentChangeFeed::Batch published;
+    if (feed.hasSubscribers()) {
+        for (const auto& [previous, current] : changes.updated) {
+            StudentChangeFeed::diff(StudentFieldState(*previous), previous, current, published);
+        }
+        std::ranges::transform(changes.removed, std::back_inserter(published), removedChange);
+        std::ranges::transform(changes.added, std::back_inserter(published), addedChange);
+    }
+    const bool flushPending = publishLocked(std::move(published));
+    lock.unlock();
+    if (flushPending) feed.scheduleFlush();
+    return changes;
+}
+
+void StudentDatabase::clear() {
+    bool flushPending = false;
+    {
+        auto lock = lockForWrite();
+        StudentChangeFeed::Batch changes;
+        if (feed.hasSubscribers()) {
+            changes.reserve(students.size());
+            students.snapshot().forEach([&changes](const std::shared_ptr<Student>& student) {
+                changes.push_back(removedChange(student));
+            });
+        }
+        students.clear();
+        flushPending = publishLocked(std::move(changes));
+    }
+    if (flushPending) feed.scheduleFlush();
+}
+
+namespace {
+    template <typename Copy>
+    std::size_t measureCopies(const StudentStore::Snapshot& students, Copy copy) {
+        std::vector<std::invoke_result_t<Copy, const Student&>> copies;
+        copies.reserve(students.size());
+        return measureLiveBytes([&] {
+            students.forEach([&](const std::shared_ptr<Student>& student) {
+                copies.push_back(copy(*student));
+            });
+            return 0;
+        });
+    }
+}
+
+MemoryFootprint StudentDatabase::memoryFootprint(MemoryFootprint::Mode mode) const {
+    TRACE_SCOPE("StudentDatabase::memoryFootprint", "database");
+    const Snapshot students = snapshot();
+    if (!allocationCountingEnabled()) {
+        mode = MemoryFootprint::Mode::Estimate;
+    }
+    MemoryFootprint footprint;
+    footprint.mode = mode;
+    footprint.studentCount = students.size();
+
+    if (mode == MemoryFootprint::Mode::Estimate) {
+        using namespace memoryEstimate;
+        std::size_t names = 0;
+        std::size_t grades = 0;
+        std::size_t scholarships = 0;
+        students.forEach([&](const std::shared_ptr<Student>& student) {
+            names += stringBytes(student->getName().size()) +
+                     stringBytes(student->getSurname().size());
+            grades += mapBytes(student->getPreviousSemesterGrades());
+            scholarships += mapBytes(student->getPreviousSemesterScholarships());
+        });
+        footprint.add("students",
+                      students.size() * heapBlockBytes(kSharedControlBlockBytes + sizeof(Student)));
+        footprint.add("student names", names);
+        footprint.add("grade history", grades);
+        footprint.add("scholarship history", scholarships);
+        footprint.add("student index", students.estimatedIndexBytes());
+        return footprint;
+    }
+
+    std::size_t names = measureCopies(students, [](const Student& student) {
+        return std::pair(student.getName(), student.getSurname());
+    });
+    std::size_t entities = measureCopies(students, [](const Student& student) {
+        return std::make_shared<Student>(student.getName(), student.getSurname(),
+                                         student.getCourse(), student.getSemester(),
+                                         student.getAverageGrade(), student.getIsBudget());
+    });
+    footprint.add("students", entities > names ? entities - names : 0);
+    footprint.add("student names", names);
+    footprint.add("grade history", measureCopies(students, [](const Student& student) {
+                      return student.getPreviousSemesterGrades();
+                  }));
+    footprint.add("scholarship history", measureCopies(students, [](const Student& student) {
+                      return student.getPreviousSemesterScholarships();
+                  }));
+    footprint.add("student index", measureLiveBytes([&students] {
+                      StudentStore index;
+                      students.forEach([&index](const std::shared_ptr<Student>& student) {
+                          index.pushBack(student);
+                      });
+                      return index;
+                  }));
+    return footprint;
+}
 
 namespace {
     struct StudentData {
+        std::size_t line = 0;
+        bool hasFields = false;
         std::string name;
         std::string surname;
         std::string funding;
@@ -137,8 +594,13 @@ namespace {
         int semester = 0;
         int missedHours = 0;
         double avgGrade = 0.0;
+        std::array<std::size_t, 5> fieldLines{};
+        std::size_t previousLine = 0;
+        std::vector<RecordDiagnostic> diagnostics;
 
-        void reset() {
+        void reset(std::size_t blockLine) {
+            line = blockLine;
+            hasFields = false;
             name.clear();
             surname.clear();
             funding.clear();
@@ -148,100 +610,140 @@ namespace {
             semester = 0;
             missedHours = 0;
             avgGrade = 0.0;
+            fieldLines.fill(0);
+            previousLine = 0;
+            diagnostics.clear();
+        }
+
+        std::size_t lineOf(StudentValidationError::Field field) const {
+            const std::size_t fieldLine = fieldLines[static_cast<std::size_t>(field)];
+            return fieldLine > 0 ? fieldLine : line;
         }
 
-        bool isValid() const {
-            return !name.empty() && !surname.empty();
+        std::string recordName() const {
+            if (name.empty() || surname.empty()) return surname + name;
+            return surname + " " + name;
         }
     };
 
-    std::string parseFieldValue(std::string_view line) {
+    std::string_view parseFieldValue(std::string_view line) {
         size_t colonPos = line.find(':');
         if (colonPos == std::string_view::npos) {
-            return "";
+            return {};
         }
-        std::string value(line.substr(colonPos + 1));
-        value.erase(0, value.find_first_not_of(" \t"));
-        value.erase(value.find_last_not_of(" \t\r\n") + 1);
-        return value;
+        std::string_view value = line.substr(colonPos + 1);
+        value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+        const auto last = value.find_last_not_of(" \t\r\n");
+        return value.substr(0, last == std::string_view::npos ? 0 : last + 1);
     }
 
-    void addPreviousGrades(std::shared_ptr<Student> student, std::string_view previous) {
-        if (previous.empty()) {
-            return;
-        }
-        std::string previousStr(previous);
-        std::istringstream iss(previousStr);
-        std::string token;
-        while (std::getline(iss, token, ';')) {
-            size_t colon = token.find(':');
-            if (colon != std::string::npos) {
-                int sem = std::stoi(token.substr(0, colon));
-                double grade = std::stod(token.substr(colon + 1));
-                student->addPreviousGrade(sem, grade);
-            }
+    template <typename T>
+    bool parseNumber(std::string_view text, T& value) {
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
+    }
+
+    template <typename T>
+    void parseNumberField(std::string_view line, std::size_t lineNumber, std::string_view field,
+                          T& value, StudentData& data) {
+        const auto text = parseFieldValue(line);
+        if (!parseNumber(text, value)) {
+            data.diagnostics.push_back(RecordDiagnostic{
+                lineNumber, {}, std::string(field), std::format("'{}' is not a number", text)});
         }
     }
 
-    std::shared_ptr<Student> createStudentFromData(const StudentData& data) {
-        bool isBudget = (data.funding == "Budget");
-        auto student = std::make_shared<Student>(data.name, data.surname, data.course, 
-                                                data.semester, data.avgGrade, isBudget);
-        student->setMissedHours(data.missedHours);
-        student->setHasSocialScholarship(data.social == "Yes");
-        addPreviousGrades(student, data.previous);
-        return student;
+    std::expected<void, std::string> addPreviousGrades(Student& student,
+                                                       std::string_view previous) {
+        while (!previous.empty()) {
+            const auto separator = previous.find(';');
+            const auto token = previous.substr(0, separator);
+            previous.remove_prefix(separator == std::string_view::npos ? previous.size()
+                                                                       : separator + 1);
+            if (token.empty()) continue;
+
+            const auto colon = token.find(':');
+            int sem = 0;
+            double grade = 0.0;
+            if (colon == std::string_view::npos || !parseNumber(token.substr(0, colon), sem) ||
+                !parseNumber(token.substr(colon + 1), grade)) {
+                return std::unexpected(std::format("'{}' is not a semester:grade pair", token));
+            }
+            student.addPreviousGrade(sem, grade);
+        }
+        return {};
     }
 
-    void parseStudentLine(std::string_view line, StudentData& data) {
+    void parseStudentLine(std::string_view line, std::size_t lineNumber, StudentData& data) {
+        using enum StudentValidationError::Field;
+        auto mark = [&data, lineNumber](StudentValidationError::Field field) {
+            data.fieldLines[static_cast<std::size_t>(field)] = lineNumber;
+            data.hasFields = true;
+        };
         if (line.starts_with("Name:")) {
             data.name = parseFieldValue(line);
+            mark(Name);
         } else if (line.starts_with("Surname:")) {
             data.surname = parseFieldValue(line);
+            mark(Surname);
         } else if (line.starts_with("Semester:")) {
-            std::string lineStr(line);
-            std::sscanf(lineStr.c_str(), "Semester: %d", &data.semester);
-            data.course = (data.semester - 1) / 2 + 1;
+            parseNumberField(line, lineNumber, "Semester", data.semester, data);
+            // Course is derived, so keep it in range and let validation name the semester.
+            data.course = std::clamp((data.semester - 1) / 2 + 1, 1, 4);
+            mark(Semester);
         } else if (line.starts_with("Avg Grade:")) {
-            std::string lineStr(line);
-            std::sscanf(lineStr.c_str(), "Avg Grade: %lf", &data.avgGrade);
+            parseNumberField(line, lineNumber, "Avg Grade", data.avgGrade, data);
+            mark(AverageGrade);
         } else if (line.starts_with("Funding:")) {
             data.funding = parseFieldValue(line);
+            data.hasFields = true;
         } else if (line.starts_with("Missed Hours:")) {
-            std::string lineStr(line);
-            std::sscanf(lineStr.c_str(), "Missed Hours: %d", &data.missedHours);
+            parseNumberField(line, lineNumber, "Missed Hours", data.missedHours, data);
+            data.hasFields = true;
         } else if (line.starts_with("Social:")) {
             data.social = parseFieldValue(line);
+            data.hasFields = true;
         } else if (line.starts_with("Previous:")) {
             data.previous = parseFieldValue(line);
+            data.previousLine = lineNumber;
+            data.hasFields = true;
         }
     }
 
-    void processStudentBlock(const StudentData& data, std::vector<std::shared_ptr<Student>>& students,
-                            std::vector<std::string>& errors) {
-        if (!data.isValid()) {
+    void processStudentBlock(StudentData& data, std::vector<std::shared_ptr<Student>>& students,
+                             std::vector<RecordDiagnostic>& diagnostics) {
+        if (!data.hasFields) {
             return;
         }
-        try {
-            auto student = createStudentFromData(data);
-            students.push_back(student);
-        } catch (const ValidationException& e) {
-            errors.push_back(std::format("Student: {} {} - {}", data.surname, data.name, e.what()));
-        } catch (const std::invalid_argument& e) {
-            errors.push_back(std::format("Student: {} {} - Invalid argument: {}", data.surname, data.name, e.what()));
-        } catch (const std::out_of_range& e) {
-            errors.push_back(std::format("Student: {} {} - Out of range: {}", data.surname, data.name, e.what()));
+        const std::string record = data.recordName();
+        if (!data.diagnostics.empty()) {
+            for (auto& diagnostic : data.diagnostics) {
+                diagnostic.record = record;
+                diagnostics.push_back(std::move(diagnostic));
+            }
+            return;
         }
-    }
-}
 
-bool StudentDatabase::saveToFile(std::string_view fname) const {
-    std::string actualFilename = fname.empty() ? filename : std::string(fname);
-    std::ofstream file(actualFilename);
-    if (!file.is_open()) {
-        throw FileWriteException(actualFilename);
+        auto student = Student::create(data.name, data.surname, data.course, data.semester,
+                                       data.avgGrade, data.funding == "Budget");
+        if (!student) {
+            const auto& error = student.error();
+            diagnostics.push_back(RecordDiagnostic{data.lineOf(error.field), record,
+                                                   std::string(error.fieldName()), error.reason});
+            return;
+        }
+        (*student)->setMissedHours(data.missedHours);
+        (*student)->setHasSocialScholarship(data.social == "Yes");
+        if (auto history = addPreviousGrades(**student, data.previous); !history) {
+            diagnostics.push_back(RecordDiagnostic{data.previousLine, record, "Previous",
+                                                   std::move(history.error())});
+            return;
+        }
+        students.push_back(std::move(*student));
     }
+}
 
+void StudentDatabase::writeFileHeader(std::ostream& out, std::size_t totalStudents) {
     auto now = std::chrono::system_clock::now();
     auto time_t = std::chrono::system_clock::to_time_t(now);
     
@@ -255,51 +757,124 @@ bool StudentDatabase::saveToFile(std::string_view fname) const {
     std::stringstream dateStream;
     dateStream << std::put_time(&tm_buf, "%Y-%m-%d");
 
-    file << std::format("# Scholarship Management System - Student Database\n");
-    file << std::format("# Generated: {}\n", dateStream.str());
-    file << std::format("# Total Students: {}\n\n", students.size());
-
-    for (size_t i = 0; i < students.size(); ++i) {
-        const auto& s = students[i];
-        file << std::format("[{}]\n", i + 1);
-        file << std::format("Name:        {}\n", s->getName());
-        file << std::format("Surname:     {}\n", s->getSurname());
-        file << std::format("Semester:    {}\n", s->getSemester());
-        file << std::format("Avg Grade:   {:.2f}\n", s->getAverageGrade());
-        file << std::format("Funding:     {}\n", s->getIsBudget() ? "Budget" : "Paid");
-        file << std::format("Missed Hours: {}\n", s->getMissedHours());
-        file << std::format("Social:      {}\n", s->getHasSocialScholarship() ? "Yes" : "No");
-        std::string history = s->getHistoryString();
-        file << std::format("Previous:    {}\n", history);
-        if (i < students.size() - 1) {
-            file << std::format("\n---\n\n");
-        }
-    }
-    file << std::format("\n# End of file\n");
+    out << std::format("# Scholarship Management System - Student Database\n");
+    out << std::format("# Generated: {}\n", dateStream.str());
+    out << std::format("# Total Students: {}\n\n", totalStudents);
+}
+
+void StudentDatabase::appendRecord(std::string& out, const Student& s, std::size_t index) {
+    auto it = std::back_inserter(out);
+    if (index > 0) {
+        std::format_to(it, "\n---\n\n");
+    }
+    std::format_to(it, "[{}]\n", index + 1);
+    std::format_to(it, "Name:        {}\n", s.getName());
+    std::format_to(it, "Surname:     {}\n", s.getSurname());
+    std::format_to(it, "Semester:    {}\n", s.getSemester());
+    std::format_to(it, "Avg Grade:   {:.2f}\n", s.getAverageGrade());
+    std::format_to(it, "Funding:     {}\n", s.getIsBudget() ? "Budget" : "Paid");
+    std::format_to(it, "Missed Hours: {}\n", s.getMissedHours());
+    std::format_to(it, "Social:      {}\n", s.getHasSocialScholarship() ? "Yes" : "No");
+    std::format_to(it, "Previous:    {}\n", s.getHistoryString());
+}
+
+void StudentDatabase::writeFileFooter(std::ostream& out) {
+    out << std::format("\n# End of file\n");
+}
+
+bool StudentDatabase::saveToFile(std::string_view fname) const {
+    return saveSnapshot(snapshot(), fname.empty() ? std::string_view(filename) : fname);
+}
+
+bool StudentDatabase::saveSnapshot(const Snapshot& students, std::string_view fname) {
+    TRACE_SCOPE("StudentDatabase::saveSnapshot", "database");
+    std::string actualFilename(fname);
+    std::ofstream file(actualFilename);
+    if (!file.is_open()) {
+        throw FileWriteException(actualFilename);
+    }
+
+    writeFileHeader(file, students.size());
+
+    std::string record;
+    std::size_t index = 0;
+    students.forEach([&](const std::shared_ptr<Student>& student) {
+        record.clear();
+        appendRecord(record, *student, index++);
+        file << record;
+    });
+    writeFileFooter(file);
     file.close();
+    if (!file) {
+        throw FileWriteException(actualFilename);
+    }
     return true;
 }
 
-bool StudentDatabase::loadFromFile(std::string_view fname) {
+LoadReport StudentDatabase::loadFromFile(std::string_view fname) {
+    TRACE_SCOPE("StudentDatabase::loadFromFile", "database");
     std::string actualFilename = fname.empty() ? filename : std::string(fname);
+
+    bool cleared = false;
+    LoadReport report = streamFromFile(
+        actualFilename, 0,
+        [this, &cleared](std::vector<std::shared_ptr<Student>>&& batch, std::size_t,
+                         std::size_t) {
+            if (!std::exchange(cleared, true)) clear();
+            addStudents(batch);
+        });
+    if (report.opened && !cleared) {
+        clear();
+    }
+    return report;
+}
+
+LoadReport StudentDatabase::streamFromFile(std::string_view fname, std::size_t batchSize,
+                                           const StudentBatchHandler& onBatch,
+                                           std::stop_token stopToken) {
+    TRACE_SCOPE("StudentDatabase::streamFromFile", "database");
+    LoadReport report;
+    std::string actualFilename(fname);
     std::ifstream file(actualFilename);
     if (!file.is_open()) {
-        return false;
+        return report;
     }
+    report.opened = true;
 
-    students.clear();
+    std::error_code sizeError;
+    auto fileSize = std::filesystem::file_size(actualFilename, sizeError);
+    const std::size_t totalBytes = sizeError ? 0 : static_cast<std::size_t>(fileSize);
 
     std::string line;
     StudentData currentData;
     bool inBlock = false;
-    std::vector<std::string> errors;
+    std::vector<std::shared_ptr<Student>> batch;
+    std::size_t bytesRead = 0;
+    std::size_t lineNumber = 0;
+
+    auto flush = [&]() {
+        if (!batch.empty()) {
+            report.accepted += batch.size();
+            onBatch(std::move(batch), bytesRead, totalBytes);
+            batch.clear();
+        }
+    };
 
     while (std::getline(file, line)) {
+        bytesRead += line.size() + 1;
+        ++lineNumber;
+
         if (line.starts_with('[') && line.contains(']')) {
             if (inBlock) {
-                processStudentBlock(currentData, students, errors);
+                processStudentBlock(currentData, batch, report.diagnostics);
+                if (batchSize > 0 && batch.size() >= batchSize) {
+                    if (stopToken.stop_requested()) {
+                        return report;
+                    }
+                    flush();
+                }
             }
-            currentData.reset();
+            currentData.reset(lineNumber);
             inBlock = true;
             continue;
         }
@@ -308,25 +883,14 @@ bool StudentDatabase::loadFromFile(std::string_view fname) {
             continue;
         }
 
-        parseStudentLine(line, currentData);
+        parseStudentLine(line, lineNumber, currentData);
     }
 
     if (inBlock) {
-        processStudentBlock(currentData, students, errors);
+        processStudentBlock(currentData, batch, report.diagnostics);
     }
+    bytesRead = std::max(bytesRead, totalBytes);
+    flush();
 
-    file.close();
-
-    if (!errors.empty()) {
-        std::string errorMsg = "Some students were skipped due to invalid data:\n";
-        for (size_t i = 0; i < errors.size(); ++i) {
-            errorMsg += errors[i];
-            if (i < errors.size() - 1) {
-                errorMsg += "\n";
-            }
-        }
-        throw ParseException(errorMsg);
-    }
-
-    return !students.empty();
-}
\ No newline at end of file
+    return report;
+}
@@ -0,0 +1,197 @@
+#include "managers/studentStore.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "diagnostics/memoryFootprint.h"
+#include "diagnostics/traceRecorder.h"
+#include "services/taskScheduler.h"
+
+std::size_t StudentStore::Snapshot::size() const {
+    return spine && !spine->ends.empty() ? spine->ends.back() : 0;
+}
+
+const StudentStore::StudentPtr& StudentStore::Snapshot::operator[](std::size_t index) const {
+    auto [chunk, offset] = locate(*spine, index);
+    return spine->chunks[chunk]->students[offset];
+}
+
+std::vector<StudentStore::StudentPtr> StudentStore::Snapshot::toVector() const {
+    std::vector<StudentPtr> students;
+    students.reserve(size());
+    for (std::size_t c = 0; c < chunkCount(); ++c) {
+        std::ranges::copy(chunk(c), std::back_inserter(students));
+    }
+    return students;
+}
+
+std::size_t StudentStore::Snapshot::estimatedIndexBytes() const {
+    using namespace memoryEstimate;
+    if (!spine) return 0;
+    std::size_t bytes = heapBlockBytes(kSharedControlBlockBytes + sizeof(Spine)) +
+                        vectorBytes(spine->chunks) + vectorBytes(spine->ends);
+    for (const auto& chunk : spine->chunks) {
+        bytes += heapBlockBytes(kSharedControlBlockBytes + sizeof(Chunk)) +
+                 vectorBytes(chunk->students);
+    }
+    return bytes;
+}
+
+StudentStore::StudentStore() : spine(std::make_shared<Spine>()) {}
+
+const StudentStore::StudentPtr& StudentStore::operator[](std::size_t index) const {
+    auto [chunk, offset] = locate(*spine, index);
+    return spine->chunks[chunk]->students[offset];
+}
+
+std::optional<std::size_t> StudentStore::find(const StudentPtr& student) const {
+    std::size_t base = 0;
+    for (const auto& chunk : spine->chunks) {
+        if (auto it = std::ranges::find(chunk->students, student); it != chunk->students.end()) {
+            return base + static_cast<std::size_t>(it - chunk->students.begin());
+        }
+        base += chunk->students.size();
+    }
+    return std::nullopt;
+}
+
+std::pair<std::size_t, std::size_t> StudentStore::locate(const Spine& spine, std::size_t index) {
+    auto it = std::ranges::upper_bound(spine.ends, index);
+    const std::size_t chunk = static_cast<std::size_t>(it - spine.ends.begin());
+    return {chunk, index - (chunk > 0 ? spine.ends[chunk - 1] : 0)};
+}
+
+StudentStore::Spine& StudentStore::mutableSpine() {
+    if (spine.use_count() > 1) {
+        spine = std::make_shared<Spine>(*spine);
+    }
+    return *spine;
+}
+
+StudentStore::Chunk& StudentStore::mutableChunk(std::size_t index) {
+    auto& chunk = spine->chunks[index];
+    if (chunk.use_count() > 1) {
+        chunk = std::make_shared<Chunk>(*chunk);
+    }
+    return *chunk;
+}
+
+void StudentStore::updateEnds(std::size_t fromChunk) {
+    auto& ends = spine->ends;
+    std::size_t running = fromChunk > 0 ? ends[fromChunk - 1] : 0;
+    ends.resize(spine->chunks.size());
+    for (std::size_t c = fromChunk; c < ends.size(); ++c) {
+        running += spine->chunks[c]->students.size();
+        ends[c] = running;
+    }
+}
+
+void StudentStore::pushBack(StudentPtr student) {
+    auto& chunks = mutableSpine().chunks;
+    if (chunks.empty() || chunks.back()->students.size() >= kChunkSize) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->students.reserve(kChunkSize);
+        chunks.push_back(std::move(chunk));
+        spine->ends.push_back(spine->ends.empty() ? 0 : spine->ends.back());
+    }
+    auto& chunk = mutableChunk(chunks.size() - 1);
+    chunk.students.push_back(std::move(student));
+    ++spine->ends.back();
+}
+
+void StudentStore::erase(std::size_t index) {
+    auto [c, offset] = locate(mutableSpine(), index);
+    auto& chunk = mutableChunk(c);
+    chunk.students.erase(chunk.students.begin() + offset);
+    if (chunk.students.empty()) {
+        spine->chunks.erase(spine->chunks.begin() + c);
+    }
+    updateEnds(c);
+}
+
+void StudentStore::eraseAt(std::vector<std::size_t> indices) {
+    if (indices.empty()) return;
+    std::ranges::sort(indices, std::greater<>());
+    indices.erase(std::ranges::unique(indices).begin(), indices.end());
+    auto& spine = mutableSpine();
+    std::size_t firstTouched = spine.chunks.size();
+    for (std::size_t index : indices) {
+        auto [c, offset] = locate(spine, index);
+        auto& chunk = mutableChunk(c);
+        chunk.students.erase(chunk.students.begin() + offset);
+        firstTouched = c;
+    }
+    std::erase_if(spine.chunks, [](const auto& chunk) { return chunk->students.empty(); });
+    updateEnds(std::min(firstTouched, spine.chunks.size()));
+}
+
+std::vector<StudentStore::StudentPtr> StudentStore::eraseIf(const StudentFilter& filter) {
+    auto& chunks = mutableSpine().chunks;
+    std::vector<StudentPtr> removed;
+    for (std::size_t c = 0; c < chunks.size(); ++c) {
+        if (std::ranges::none_of(chunks[c]->students, filter)) continue;
+        auto& chunk = mutableChunk(c);
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < chunk.students.size(); ++i) {
+            if (filter(chunk.students[i])) {
+                removed.push_back(std::move(chunk.students[i]));
+            } else {
+                chunk.students[kept] = std::move(chunk.students[i]);
+                ++kept;
+            }
+        }
+        chunk.students.resize(kept);
+    }
+    if (!removed.empty()) {
+        std::erase_if(chunks, [](const auto& chunk) { return chunk->students.empty(); });
+        updateEnds(0);
+    }
+    return removed;
+}
+
+void StudentStore::clear() { spine = std::make_shared<Spine>(); }
+
+void StudentStore::editSlot(Chunk& chunk, std::size_t chunkIndex, std::size_t offset,
+                            const StudentEditor& editor) {
+    auto& slot = chunk.students[offset];
+    auto copy = std::make_shared<Student>(*slot);
+    editor(chunkIndex, slot, copy);
+    slot = std::move(copy);
+}
+
+void StudentStore::replace(std::size_t index, StudentPtr student) {
+    auto [c, offset] = locate(mutableSpine(), index);
+    auto& chunk = mutableChunk(c);
+    chunk.students[offset] = std::move(student);
+}
+
+StudentStore::StudentPtr StudentStore::update(std::size_t index, const StudentMutator& mutator) {
+    auto [c, offset] = locate(mutableSpine(), index);
+    auto& chunk = mutableChunk(c);
+    editSlot(chunk, c, offset,
+             [&mutator](std::size_t, const StudentPtr&, const StudentPtr& current) {
+                 mutator(*current);
+             });
+    return chunk.students[offset];
+}
+
+bool StudentStore::updateChunks(const StudentFilter& filter, const StudentEditor& editor,
+                                std::size_t grain, std::stop_token stopToken) {
+    TRACE_SCOPE("StudentStore::updateChunks", "database");
+    auto& chunks = mutableSpine().chunks;
+    return TaskScheduler::instance().parallelFor(
+        chunks.size(), std::max<std::size_t>(1, grain / kChunkSize),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                if (filter && std::ranges::none_of(chunks[c]->students, filter)) continue;
+                auto& chunk = mutableChunk(c);
+                for (std::size_t i = 0; i < chunk.students.size(); ++i) {
+                    if (!filter || filter(chunk.students[i])) {
+                        editSlot(chunk, c, i, editor);
+                    }
+                }
+            }
+        },
+        TaskPriority::Interactive, stopToken);
+}
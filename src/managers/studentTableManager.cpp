@@ -1,40 +1,43 @@
 #include "managers/studentTableManager.h"
 
 #include <QAbstractItemView>
-#include <QBrush>
 #include <QFont>
-#include <QHBoxLayout>
+#include <QGuiApplication>
 #include <QHeaderView>
-#include <QPushButton>
-#include <QStringList>
-#include <QTableWidget>
-#include <QTableWidgetItem>
-#include <QVariant>
-#include <QWidget>
+#include <QItemSelectionModel>
+#include <QTableView>
+#include <algorithm>
 
+#include "diagnostics/traceRecorder.h"
 #include "entities/student.h"
+#include "managers/studentTableModel.h"
 
-StudentTableManager::StudentTableManager(QTableWidget* tableWidget, QObject* parent)
-    : QObject(parent), table(tableWidget) {}
+StudentTableManager::StudentTableManager(QTableView* tableView, QObject* parent)
+    : QObject(parent), table(tableView), model(new StudentTableModel(this)) {}
 
-void StudentTableManager::configure(QObject* eventFilterOwner) {
+void StudentTableManager::configure() {
     if (!table) return;
 
-    table->setColumnCount(10);
-    auto headers = QStringList{"#",        "Name",         "Surname",       "Course",
-                               "Semester", "Funding Type", "Average Grade", "Missed Hours",
-                               "Social",   "Actions"};
-    table->setHorizontalHeaderLabels(headers);
+    table->setModel(model);
+    actionDelegate = new StudentActionDelegate(table);
+    connect(actionDelegate, &StudentActionDelegate::actionTriggered, this,
+            &StudentTableManager::onActionTriggered);
+    attachActionDelegate();
+
     table->verticalHeader()->setVisible(false);
+    table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    table->verticalHeader()->setDefaultSectionSize(44);
     table->setSelectionBehavior(QAbstractItemView::SelectRows);
-    table->setSelectionMode(QAbstractItemView::NoSelection);
+    table->setSelectionMode(QAbstractItemView::ExtendedSelection);
     table->setEditTriggers(QAbstractItemView::NoEditTriggers);
     table->setAlternatingRowColors(true);
     table->horizontalHeader()->setStretchLastSection(false);
     table->setSortingEnabled(false);
-    if (table->horizontalHeader() && eventFilterOwner) {
-        table->horizontalHeader()->installEventFilter(eventFilterOwner);
-    }
+    table->horizontalHeader()->setSectionsClickable(true);
+    table->horizontalHeader()->setSortIndicatorShown(true);
+    table->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+    connect(table->horizontalHeader(), &QHeaderView::sectionClicked, this,
+            &StudentTableManager::onHeaderClicked);
 
     QFont baseFont("SF Pro Display", 11, QFont::Normal);  
     baseFont.setStyleHint(QFont::SansSerif);
@@ -62,430 +65,177 @@ void StudentTableManager::configure(QObject* eventFilterOwner) {
         "}");
 
     table->setStyleSheet(
-        "QTableWidget {"
+        "QTableView {"
         "gridline-color: #2d2d2d;"
         "background-color: #1B1B1B;"
         "alternate-background-color: #1E1E1E;"
         "border: 2px solid #0d7377;"
         "border-radius: 8px;"
         "}"
-        "QTableWidget::item {"
+        "QTableView::item {"
         "padding: 12px 10px;"  
         "border: none;"
         "}"
-        "QTableWidget::item:alternate {"
+        "QTableView::item:alternate {"
         "background-color: #1E1E1E;"
+        "}"
+        "QTableView::item:selected {"
+        "background-color: #0d7377;"
+        "color: #ffffff;"
         "}");
 
-    connect(table, &QTableWidget::itemSelectionChanged, this,
-            &StudentTableManager::updateSelectionVisual);
-    connect(table, &QTableWidget::currentItemChanged, this,
-            [this](QTableWidgetItem*, QTableWidgetItem*) { updateSelectionVisual(); });
-}
-
-void StudentTableManager::ensureScholarshipColumn(bool scholarshipsCalculated) {
-    if (!table) return;
-    int baseColumns = 10;  
-    if (scholarshipsCalculated && table->columnCount() == baseColumns) {
-        table->insertColumn(9);
-        table->setHorizontalHeaderItem(9, new QTableWidgetItem("Scholarship (BYN)"));
-        table->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
-        table->horizontalHeader()->setStretchLastSection(false);
-    } else if (!scholarshipsCalculated && table->columnCount() == baseColumns + 1) {
-        table->removeColumn(9);
-        table->horizontalHeader()->setStretchLastSection(false);
-    }
+    connect(table->selectionModel(), &QItemSelectionModel::currentRowChanged, this,
+            &StudentTableManager::onCurrentRowChanged);
 }
 
 void StudentTableManager::populate(const std::vector<std::shared_ptr<Student>>& students,
                                    bool scholarshipsCalculated) {
+    TRACE_SCOPE("StudentTableManager::populate", "table");
     if (!table) return;
 
-    ensureScholarshipColumn(scholarshipsCalculated);
-
-    table->blockSignals(true);
-    table->setRowCount(0);
+    model->setStudents(students, scholarshipsCalculated);
+    attachActionDelegate();
+    updateSortIndicator();
+    setupColumnWidths(scholarshipsCalculated);
+}
 
-    QColor defaultTextColor(234, 234, 234);
-    QFont itemFont;
-    itemFont.setPointSize(11);
-    itemFont.setFamily("SF Pro Display");
-    itemFont.setStyleHint(QFont::SansSerif);
+void StudentTableManager::appendStudent(const std::shared_ptr<Student>& student) {
+    model->appendStudent(student);
+}
 
-    int rowNum = 1;
-    for (const auto& student : students) {
-        if (!student) continue;
+void StudentTableManager::appendStudents(const std::vector<std::shared_ptr<Student>>& students) {
+    TRACE_SCOPE("StudentTableManager::appendStudents", "table");
+    model->appendStudents(students);
+}
 
-        int row = table->rowCount();
-        table->insertRow(row);
-        table->setRowHeight(row, 44);
+void StudentTableManager::refreshRow(int row) { model->refreshStudent(row); }
 
-        createRowItems(row, rowNum, student, itemFont, defaultTextColor, scholarshipsCalculated);
-    }
-
-    setupColumnWidths(scholarshipsCalculated);
+void StudentTableManager::replaceRow(int row, const std::shared_ptr<Student>& student) {
+    model->replaceStudent(row, student);
+}
 
-    updateRowNumbers();
-    table->blockSignals(false);
-    updateSelectionVisual();
-    applyMissedHoursStyling();
+void StudentTableManager::replaceStudents(const std::vector<StudentReplacement>& replacements) {
+    model->replaceStudents(replacements);
 }
 
-void StudentTableManager::createRowItems(int row, int& rowNum, const std::shared_ptr<Student>& student,
-                                         const QFont& itemFont, const QColor& defaultTextColor,
-                                         bool scholarshipsCalculated) {
-    int currentRowNum = rowNum;
-    rowNum++;
-    auto numItem = createNumberItem(currentRowNum, itemFont);
-    table->setItem(row, 0, numItem);
-
-    auto nameFont = itemFont;
-    nameFont.setWeight(QFont::Medium);
-
-    auto nameItem =
-        new QTableWidgetItem(QString::fromStdString(student->getName()));
-    nameItem->setForeground(QBrush(defaultTextColor));
-    nameItem->setFont(nameFont);
-    table->setItem(row, 1, nameItem);
-
-    auto surnameItem =
-        new QTableWidgetItem(QString::fromStdString(student->getSurname()));
-    surnameItem->setForeground(QBrush(defaultTextColor));
-    surnameItem->setFont(nameFont);
-    table->setItem(row, 2, surnameItem);
-
-    auto courseItem = new QTableWidgetItem(QString::number(student->getCourse()));
-    courseItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    courseItem->setForeground(QBrush(defaultTextColor));
-    courseItem->setFont(itemFont);
-    table->setItem(row, 3, courseItem);
-
-    auto semesterItem =
-        new QTableWidgetItem(QString::number(student->getSemester()));
-    semesterItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    semesterItem->setForeground(QBrush(defaultTextColor));
-    semesterItem->setFont(itemFont);
-    table->setItem(row, 4, semesterItem);
-
-    QString funding = student->getIsBudget() ? "Budget" : "Paid";
-    auto fundingItem = new QTableWidgetItem(funding);
-    fundingItem->setForeground(QBrush(defaultTextColor));
-    fundingItem->setFont(itemFont);
-    table->setItem(row, 5, fundingItem);
-
-    double avgGrade = student->getAverageGrade();
-    auto gradeItem = new QTableWidgetItem(QString::number(avgGrade, 'f', 2));
-    gradeItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    gradeItem->setForeground(QBrush(defaultTextColor));
-    gradeItem->setFont(itemFont);
-    table->setItem(row, 6, gradeItem);
-
-    auto missedItem = createMissedHoursItem(student, itemFont, defaultTextColor);
-    table->setItem(row, 7, missedItem);
-
-    auto socialItem =
-        new QTableWidgetItem(student->getHasSocialScholarship() ? "Yes" : "No");
-    socialItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    socialItem->setData(Qt::UserRole, 0);
-    socialItem->setForeground(QBrush(defaultTextColor));
-    socialItem->setFont(itemFont);
-    table->setItem(row, 8, socialItem);
-
-    if (scholarshipsCalculated && table->columnCount() > 9) {
-        double scholarship = student->getScholarship();
-        auto scholarshipItem = createScholarshipItem(scholarship, itemFont);
-        table->setItem(row, 9, scholarshipItem);
-    }
+void StudentTableManager::removeRow(int row) { model->removeStudent(row); }
 
-    int actionsCol;
-    if (scholarshipsCalculated && table->columnCount() > 9) {
-        actionsCol = 10;
-    } else {
-        actionsCol = 9;
-    }
-    auto actionsWidget = createActionButtons(row);
-    table->setCellWidget(row, actionsCol, actionsWidget);
+void StudentTableManager::applyChanges(const StudentChangeSet& changes) {
+    TRACE_SCOPE("StudentTableManager::applyChanges", "table");
+    model->removeStudents(changes.removed);
+    model->replaceStudents(changes.updated);
+    model->appendStudents(changes.added);
 }
 
-QTableWidgetItem* StudentTableManager::createNumberItem(int rowNum, const QFont& itemFont) {
-    auto numItem = new QTableWidgetItem(QString::number(rowNum));
-    numItem->setTextAlignment(Qt::AlignCenter);
-    numItem->setBackground(QBrush(QColor(0, 0, 0, 0)));
-    numItem->setForeground(QBrush(QColor(180, 180, 180)));
-    numItem->setFlags(numItem->flags() & ~Qt::ItemIsSelectable);
-    numItem->setData(Qt::UserRole, QVariant());
-    numItem->setFont(itemFont);
-    return numItem;
+std::shared_ptr<Student> StudentTableManager::studentAt(int row) const {
+    return model->studentAt(row);
 }
 
-QTableWidgetItem* StudentTableManager::createMissedHoursItem(const std::shared_ptr<Student>& student,
-                                                             const QFont& itemFont,
-                                                             const QColor& defaultTextColor) {
-    auto missedItem =
-        new QTableWidgetItem(QString::number(student->getMissedHours()));
-    missedItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    QColor redColor(255, 100, 100);
-    if (student->getMissedHours() >= 12) {
-        missedItem->setData(Qt::UserRole + 10, true);
-        missedItem->setData(Qt::UserRole + 11, redColor);
-        missedItem->setForeground(QBrush(redColor));
-        auto boldFont = itemFont;
-        boldFont.setWeight(QFont::Bold);
-        missedItem->setFont(boldFont);
-    } else {
-        missedItem->setData(Qt::UserRole + 10, false);
-        missedItem->setData(Qt::UserRole + 11, QColor());
-        missedItem->setForeground(QBrush(defaultTextColor));
-        missedItem->setFont(itemFont);
+std::vector<std::shared_ptr<Student>> StudentTableManager::selectedStudents() const {
+    std::vector<std::shared_ptr<Student>> selected;
+    if (!table || !table->selectionModel()) return selected;
+    const QModelIndexList rows = table->selectionModel()->selectedRows();
+    selected.reserve(rows.size());
+    for (const QModelIndex& index : rows) {
+        if (auto student = model->studentAt(index.row())) {
+            selected.push_back(std::move(student));
+        }
     }
-    return missedItem;
+    return selected;
 }
 
-QTableWidgetItem* StudentTableManager::createScholarshipItem(double scholarship,
-                                                             const QFont& itemFont) {
-    auto scholarshipItem =
-        new QTableWidgetItem(QString::number(scholarship, 'f', 2));
-    scholarshipItem->setTextAlignment(Qt::AlignCenter | Qt::AlignVCenter);
-    scholarshipItem->setData(Qt::UserRole, 0);
-    scholarshipItem->setData(Qt::UserRole + 2, scholarship);
-
-    auto scholarshipFont = itemFont;
-    if (scholarship > 0) {
-        scholarshipItem->setData(Qt::UserRole + 1, QColor(100, 230, 100));
-        scholarshipFont.setWeight(QFont::DemiBold);
-        scholarshipItem->setFont(scholarshipFont);
-        scholarshipItem->setForeground(QBrush(QColor(100, 230, 100)));
-    } else {
-        scholarshipItem->setData(Qt::UserRole + 1, QColor(180, 180, 180));
-        scholarshipItem->setFont(scholarshipFont);
-        scholarshipItem->setForeground(QBrush(QColor(180, 180, 180)));
-    }
-    return scholarshipItem;
+int StudentTableManager::rowOf(const std::shared_ptr<Student>& student) const {
+    return model->rowOf(student);
 }
 
-void StudentTableManager::setupColumnWidths(bool scholarshipsCalculated) {
-    if (table->columnCount() == 11 && scholarshipsCalculated) {
-        for (int i = 0; i < 11; ++i) {
-            table->resizeColumnToContents(i);
-        }
-        table->horizontalHeader()->setStretchLastSection(false);
-    } else {
-        table->resizeColumnsToContents();
-    }
+int StudentTableManager::rowCount() const { return model->rowCount(); }
 
-    table->setColumnWidth(1, 100);  
-    table->setColumnWidth(2, 120);  
-    table->setColumnWidth(5, 100);  
-    table->setColumnWidth(6, 110);  
-    table->setColumnWidth(7, 100);  
-    table->setColumnWidth(8, 70);   
-    if (scholarshipsCalculated && table->columnCount() > 9) {
-        table->setColumnWidth(9, 130);  
-        table->setColumnWidth(10, 120);  
-    } else {
-        table->setColumnWidth(9, 120);  
-    }
+MemoryFootprint StudentTableManager::memoryFootprint(MemoryFootprint::Mode mode) const {
+    TRACE_SCOPE("StudentTableManager::memoryFootprint", "table");
+    return model->memoryFootprint(mode);
 }
 
-void StudentTableManager::applyMissedHoursStyling() const {
-    if (!table) return;
-    for (int row = 0; row < table->rowCount(); ++row) {
-        QTableWidgetItem* missedItem = table->item(row, 7);
-        if (missedItem && missedItem->data(Qt::UserRole + 10).toBool()) {
-            QColor redColor = missedItem->data(Qt::UserRole + 11).value<QColor>();
-            if (!redColor.isValid()) redColor = QColor(255, 100, 100);
-            missedItem->setForeground(QBrush(redColor));
-            QFont font = missedItem->font();
-            font.setWeight(QFont::Bold);
-            missedItem->setFont(font);
-        } else if (missedItem) {
-            QColor defaultTextColor(234, 234, 234);
-            missedItem->setForeground(QBrush(defaultTextColor));
-            QFont font = missedItem->font();
-            font.setWeight(QFont::Normal);
-            missedItem->setFont(font);
-        }
+void StudentTableManager::setupColumnWidths(bool scholarshipsCalculated) {
+    table->resizeColumnsToContents();
+
+    table->setColumnWidth(1, 100);
+    table->setColumnWidth(2, 120);
+    table->setColumnWidth(5, 100);
+    table->setColumnWidth(6, 110);
+    table->setColumnWidth(7, 100);
+    table->setColumnWidth(8, 70);
+    if (scholarshipsCalculated) {
+        table->setColumnWidth(9, 130);
+        table->setColumnWidth(10, 120);
+    } else {
+        table->setColumnWidth(9, 120);
     }
 }
 
-bool StudentTableManager::shouldSkipColumn(int col) const {
-    return (col == 9 && table->columnCount() == 10) || (col == 10 && table->columnCount() == 11);
+void StudentTableManager::onCurrentRowChanged(const QModelIndex& current, const QModelIndex&) {
+    model->setHighlightedRow(current.isValid() ? current.row() : -1);
 }
 
-void StudentTableManager::applyItemForegroundColor(QTableWidgetItem* item, int col, const QColor& defaultColor) const {
-    if (col == 0) {
-        item->setForeground(QBrush(QColor(180, 180, 180)));
-        return;
-    }
-    
-    if (col == 7 && item->data(Qt::UserRole + 10).toBool()) {
-        auto redColor = item->data(Qt::UserRole + 11).value<QColor>();
-        if (!redColor.isValid()) {
-            redColor = QColor(255, 100, 100);
-        }
-        item->setForeground(QBrush(redColor));
-        return;
-    }
-    
-    if (col == 7) {
-        item->setForeground(QBrush(defaultColor));
-        return;
-    }
-    
-    if (col == 9 && table->columnCount() == 11 && item->data(Qt::UserRole + 2).isValid()) {
-        auto storedColor = item->data(Qt::UserRole + 1).value<QColor>();
-        item->setForeground(QBrush(storedColor.isValid() ? storedColor : defaultColor));
+void StudentTableManager::onHeaderClicked(int section) {
+    auto field = StudentTableModel::sortFieldFor(model->columnAt(section));
+    if (!field) {
+        model->sortBy({});
+        updateSortIndicator();
         return;
     }
-    
-    item->setForeground(QBrush(defaultColor));
-}
-
-void StudentTableManager::updateSelectionVisual() const {
-    if (!table) return;
-
-    QColor defaultColor(234, 234, 234);
-
-    for (int row = 0; row < table->rowCount(); ++row) {
-        for (int col = 0; col < table->columnCount(); ++col) {
-            if (shouldSkipColumn(col)) {
-                continue;
-            }
 
-            auto item = table->item(row, col);
-            if (!item) {
-                continue;
-            }
+    auto keys = model->sortKeys();
+    auto existing = std::ranges::find_if(
+        keys, [&field](const StudentSortKey& key) { return key.field == *field; });
 
-            item->setBackground(QBrush(Qt::transparent));
-            applyItemForegroundColor(item, col, defaultColor);
-        }
-    }
-}
-
-void StudentTableManager::updateRowNumbers() {
-    if (!table) return;
-    for (int row = 0; row < table->rowCount(); ++row) {
-        QTableWidgetItem* numItem = table->item(row, 0);
-        if (numItem) {
-            numItem->setText(QString::number(row + 1));
+    if (QGuiApplication::keyboardModifiers() & Qt::ShiftModifier) {
+        if (existing != keys.end()) {
+            existing->ascending = !existing->ascending;
         } else {
-            numItem = new QTableWidgetItem(QString::number(row + 1));
-            numItem->setTextAlignment(Qt::AlignCenter);
-            numItem->setBackground(QBrush(QColor(0, 0, 0, 0)));
-            numItem->setForeground(QBrush(QColor(180, 180, 180)));
-            numItem->setFlags(numItem->flags() & ~Qt::ItemIsSelectable);
-
-            QFont font;
-            font.setPointSize(10);
-            font.setFamily("Segoe UI");
-            numItem->setFont(font);
-
-            table->setItem(row, 0, numItem);
+            keys.push_back(StudentSortKey{*field, true});
         }
+    } else {
+        bool isPrimary = existing == keys.begin() && existing != keys.end();
+        keys = {StudentSortKey{*field, !(isPrimary && existing->ascending)}};
     }
-}
 
-QWidget* StudentTableManager::createActionButtons(int row) {
-    auto widget = new QWidget();
-    widget->setFixedHeight(27);
-    widget->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
-    auto layout = new QHBoxLayout(widget);
-    layout->setContentsMargins(5, 0, 5, 2);
-    layout->setSpacing(5);
-    layout->setAlignment(Qt::AlignCenter);
-
-    
-    auto editBtn = new QPushButton("✏️");
-    editBtn->setToolTip("Edit Student");
-    editBtn->setFixedSize(27, 27);
-    editBtn->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-    editBtn->setStyleSheet(
-        "QPushButton {"
-        "background-color: #0d7377;"
-        "color: white;"
-        "border: none;"
-        "border-radius: 4px;"
-        "font-size: 10px;"
-        "}"
-        "QPushButton:hover {"
-        "background-color: #14a085;"
-        "}"
-        "QPushButton:pressed {"
-        "background-color: #0a5d61;"
-        "}");
-    editBtn->setProperty("row", row);
-    connect(editBtn, &QPushButton::clicked, this, &StudentTableManager::onEditClicked);
-    layout->addWidget(editBtn);
-
-    auto viewBtn = new QPushButton("👁️");
-    viewBtn->setToolTip("View History");
-    viewBtn->setFixedSize(27, 27);
-    editBtn->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-    viewBtn->setStyleSheet(
-        "QPushButton {"
-        "background-color: #0d7377;"
-        "color: white;"
-        "border: none;"
-        "border-radius: 4px;"
-        "font-size: 14px;"
-        "}"
-        "QPushButton:hover {"
-        "background-color: #14a085;"
-        "}"
-        "QPushButton:pressed {"
-        "background-color: #0a5d61;"
-        "}");
-    viewBtn->setProperty("row", row);
-    connect(viewBtn, &QPushButton::clicked, this, &StudentTableManager::onViewClicked);
-    layout->addWidget(viewBtn);
-
-    // Delete button (cross/X icon)
-    auto deleteBtn = new QPushButton("❌");
-    deleteBtn->setToolTip("Delete Student");
-    deleteBtn->setFixedSize(27, 27);
-    editBtn->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-    deleteBtn->setStyleSheet(
-        "QPushButton {"
-        "background-color: #d32f2f;"
-        "color: white;"
-        "border: none;"
-        "border-radius: 4px;"
-        "font-size: 14px;"
-        "}"
-        "QPushButton:hover {"
-        "background-color: #f44336;"
-        "}"
-        "QPushButton:pressed {"
-        "background-color: #b71c1c;"
-        "}");
-    deleteBtn->setProperty("row", row);
-    connect(deleteBtn, &QPushButton::clicked, this, &StudentTableManager::onDeleteClicked);
-    layout->addWidget(deleteBtn);
-
-    return widget;
+    model->sortBy(keys);
+    updateSortIndicator();
 }
 
-void StudentTableManager::onEditClicked() {
-    const QPushButton* btn = qobject_cast<const QPushButton*>(sender());
-    if (btn) {
-        int row = btn->property("row").toInt();
-        emit editStudentRequested(row);
+void StudentTableManager::updateSortIndicator() {
+    const auto& keys = model->sortKeys();
+    if (keys.empty()) {
+        table->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+        return;
     }
+    int section = model->sectionOf(StudentTableModel::columnFor(keys.front().field));
+    table->horizontalHeader()->setSortIndicator(
+        section, keys.front().ascending ? Qt::AscendingOrder : Qt::DescendingOrder);
 }
 
-void StudentTableManager::onDeleteClicked() {
-    const QPushButton* btn = qobject_cast<const QPushButton*>(sender());
-    if (btn) {
-        int row = btn->property("row").toInt();
-        emit deleteStudentRequested(row);
+void StudentTableManager::attachActionDelegate() {
+    int actionsCol = model->sectionOf(StudentTableModel::Column::Actions);
+    if (actionsCol == actionDelegateColumn) {
+        return;
     }
+    if (actionDelegateColumn >= 0) {
+        table->setItemDelegateForColumn(actionDelegateColumn, nullptr);
+    }
+    table->setItemDelegateForColumn(actionsCol, actionDelegate);
+    actionDelegateColumn = actionsCol;
 }
 
-void StudentTableManager::onViewClicked() {
-    const QPushButton* btn = qobject_cast<const QPushButton*>(sender());
-    if (btn) {
-        int row = btn->property("row").toInt();
-        emit viewHistoryRequested(row);
+void StudentTableManager::onActionTriggered(int row, StudentActionDelegate::Action action) {
+    switch (action) {
+        case StudentActionDelegate::Action::Edit:
+            emit editStudentRequested(row);
+            break;
+        case StudentActionDelegate::Action::ViewHistory:
+            emit viewHistoryRequested(row);
+            break;
+        case StudentActionDelegate::Action::Delete:
+            emit deleteStudentRequested(row);
+            break;
     }
-}
\ No newline at end of file
+}
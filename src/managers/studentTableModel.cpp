@@ -0,0 +1,510 @@
+#include "managers/studentTableModel.h"
+
+#include <QBrush>
+#include <QColor>
+#include <QString>
+#include <QStringList>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "entities/student.h"
+
+namespace {
+const QColor kDefaultTextColor(234, 234, 234);
+const QColor kMutedTextColor(180, 180, 180);
+const QColor kMissedHoursColor(255, 100, 100);
+const QColor kScholarshipColor(100, 230, 100);
+const QColor kHighlightColor(13, 115, 119, 70);
+
+constexpr int kMissedHoursLimit = 12;
+}
+
+StudentTableModel::StudentTableModel(QObject* parent) : QAbstractTableModel(parent) {
+    itemFont.setPointSize(11);
+    itemFont.setFamily("SF Pro Display");
+    itemFont.setStyleHint(QFont::SansSerif);
+
+    nameFont = itemFont;
+    nameFont.setWeight(QFont::Medium);
+
+    boldFont = itemFont;
+    boldFont.setWeight(QFont::Bold);
+
+    scholarshipFont = itemFont;
+    scholarshipFont.setWeight(QFont::DemiBold);
+}
+
+int StudentTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(students.size());
+}
+
+int StudentTableModel::columnCount(const QModelIndex& parent) const {
+    if (parent.isValid()) return 0;
+    return scholarshipVisible ? 11 : 10;
+}
+
+StudentTableModel::Column StudentTableModel::columnAt(int section) const {
+    if (!scholarshipVisible && section >= static_cast<int>(Column::Scholarship)) {
+        return static_cast<Column>(section + 1);
+    }
+    return static_cast<Column>(section);
+}
+
+int StudentTableModel::sectionOf(Column column) const {
+    if (column == Column::Scholarship && !scholarshipVisible) {
+        return -1;
+    }
+    if (!scholarshipVisible && column == Column::Actions) {
+        return static_cast<int>(Column::Actions) - 1;
+    }
+    return static_cast<int>(column);
+}
+
+MemoryFootprint StudentTableModel::memoryFootprint(MemoryFootprint::Mode mode) const {
+    MemoryFootprint footprint = sorter.memoryFootprint(students, mode);
+    footprint.add("table rows", memoryEstimate::vectorBytes(students));
+    footprint.add("table row order", memoryEstimate::vectorBytes(order));
+    return footprint;
+}
+
+QVariant StudentTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= static_cast<int>(students.size())) {
+        return {};
+    }
+    const auto& student = students[order[index.row()]];
+    if (!student) return {};
+
+    Column column = columnAt(index.column());
+    switch (role) {
+        case Qt::DisplayRole:
+            return displayData(*student, column, index.row());
+        case Qt::ForegroundRole:
+            return foregroundData(*student, column);
+        case Qt::FontRole:
+            return fontData(*student, column);
+        case Qt::TextAlignmentRole:
+            return alignmentData(column);
+        case Qt::BackgroundRole:
+            if (highlightedRow.isValid() && highlightedRow.row() == index.row()) {
+                return QBrush(kHighlightColor);
+            }
+            return {};
+        case MissedHoursExceededRole:
+            return student->getMissedHours() >= kMissedHoursLimit;
+        case ScholarshipAmountRole:
+            return student->getScholarship();
+        default:
+            return {};
+    }
+}
+
+QVariant StudentTableModel::displayData(const Student& student, Column column, int row) const {
+    switch (column) {
+        case Column::Number:
+            return row + 1;
+        case Column::Name:
+            return QString::fromStdString(student.getName());
+        case Column::Surname:
+            return QString::fromStdString(student.getSurname());
+        case Column::Course:
+            return student.getCourse();
+        case Column::Semester:
+            return student.getSemester();
+        case Column::Funding:
+            return student.getIsBudget() ? QStringLiteral("Budget") : QStringLiteral("Paid");
+        case Column::AverageGrade:
+            return QString::number(student.getAverageGrade(), 'f', 2);
+        case Column::MissedHours:
+            return student.getMissedHours();
+        case Column::Social:
+            return student.getHasSocialScholarship() ? QStringLiteral("Yes") : QStringLiteral("No");
+        case Column::Scholarship:
+            return QString::number(student.getScholarship(), 'f', 2);
+        case Column::Actions:
+            return {};
+    }
+    return {};
+}
+
+QVariant StudentTableModel::foregroundData(const Student& student, Column column) const {
+    switch (column) {
+        case Column::Number:
+            return QBrush(kMutedTextColor);
+        case Column::MissedHours:
+            if (student.getMissedHours() >= kMissedHoursLimit) {
+                return QBrush(kMissedHoursColor);
+            }
+            return QBrush(kDefaultTextColor);
+        case Column::Scholarship:
+            return QBrush(student.getScholarship() > 0 ? kScholarshipColor : kMutedTextColor);
+        default:
+            return QBrush(kDefaultTextColor);
+    }
+}
+
+QVariant StudentTableModel::fontData(const Student& student, Column column) const {
+    switch (column) {
+        case Column::Name:
+        case Column::Surname:
+            return nameFont;
+        case Column::MissedHours:
+            return student.getMissedHours() >= kMissedHoursLimit ? boldFont : itemFont;
+        case Column::Scholarship:
+            return student.getScholarship() > 0 ? scholarshipFont : itemFont;
+        default:
+            return itemFont;
+    }
+}
+
+QVariant StudentTableModel::alignmentData(Column column) const {
+    switch (column) {
+        case Column::Number:
+        case Column::Course:
+        case Column::Semester:
+        case Column::AverageGrade:
+        case Column::MissedHours:
+        case Column::Social:
+        case Column::Scholarship:
+            return QVariant::fromValue(Qt::Alignment(Qt::AlignCenter));
+        default:
+            return QVariant::fromValue(Qt::Alignment(Qt::AlignLeft | Qt::AlignVCenter));
+    }
+}
+
+QVariant StudentTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (orientation == Qt::Horizontal && role == Qt::ToolTipRole) {
+        if (sortFieldFor(columnAt(section))) {
+            return QStringLiteral("Click to sort, Shift+click to add a secondary sort key");
+        }
+        return {};
+    }
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    static const QStringList headers{"#",        "Name",         "Surname",       "Course",
+                                     "Semester", "Funding Type", "Average Grade", "Missed Hours",
+                                     "Social",   "Scholarship (BYN)", "Actions"};
+    auto column = static_cast<int>(columnAt(section));
+    if (column < 0 || column >= headers.size()) {
+        return {};
+    }
+    return headers[column];
+}
+
+Qt::ItemFlags StudentTableModel::flags(const QModelIndex& index) const {
+    if (!index.isValid()) return Qt::NoItemFlags;
+    if (columnAt(index.column()) == Column::Number) {
+        return Qt::ItemIsEnabled;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void StudentTableModel::setStudents(const std::vector<std::shared_ptr<Student>>& newStudents,
+                                    bool showScholarship) {
+    beginResetModel();
+    students = newStudents;
+    std::erase(students, nullptr);
+    scholarshipVisible = showScholarship;
+    sorter.reset();
+    order = sorter.sortedOrder(students, activeSortKeys);
+    endResetModel();
+}
+
+std::shared_ptr<Student> StudentTableModel::studentAt(int row) const {
+    if (row < 0 || row >= static_cast<int>(order.size())) {
+        return nullptr;
+    }
+    return students[order[row]];
+}
+
+int StudentTableModel::rowOf(const std::shared_ptr<Student>& student) const {
+    auto base = std::ranges::find(students, student);
+    if (base == students.end()) return -1;
+    auto row = std::ranges::find(order, static_cast<int>(base - students.begin()));
+    return row == order.end() ? -1 : static_cast<int>(row - order.begin());
+}
+
+int StudentTableModel::sortedPosition(int baseIndex, int skipRow) const {
+    const int size = static_cast<int>(order.size()) - (skipRow >= 0 ? 1 : 0);
+    auto at = [this, skipRow](int position) {
+        return order[skipRow >= 0 && position >= skipRow ? position + 1 : position];
+    };
+
+    int low = 0;
+    int high = size;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (sorter.less(activeSortKeys, baseIndex, at(middle))) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+void StudentTableModel::appendStudent(const std::shared_ptr<Student>& student) {
+    if (!student) return;
+    const int baseIndex = static_cast<int>(students.size());
+    students.push_back(student);
+    sorter.append(*student);
+    sorter.prepare(students, activeSortKeys);
+
+    const int row = activeSortKeys.empty() ? baseIndex : sortedPosition(baseIndex, -1);
+    beginInsertRows(QModelIndex(), row, row);
+    order.insert(order.begin() + row, baseIndex);
+    endInsertRows();
+}
+
+void StudentTableModel::appendStudents(const std::vector<std::shared_ptr<Student>>& batch) {
+    if (!activeSortKeys.empty()) {
+        for (const auto& student : batch) {
+            appendStudent(student);
+        }
+        return;
+    }
+
+    const auto count = std::ranges::count_if(
+        batch, [](const std::shared_ptr<Student>& student) { return student != nullptr; });
+    if (count == 0) return;
+
+    const int first = static_cast<int>(students.size());
+    beginInsertRows(QModelIndex(), first, first + static_cast<int>(count) - 1);
+    for (const auto& student : batch) {
+        if (!student) continue;
+        order.push_back(static_cast<int>(students.size()));
+        students.push_back(student);
+        sorter.append(*student);
+    }
+    endInsertRows();
+}
+
+void StudentTableModel::refreshStudent(int row) {
+    if (row < 0 || row >= static_cast<int>(order.size())) return;
+    refreshRow(row);
+}
+
+int StudentTableModel::refreshRow(int row) {
+    const int baseIndex = order[row];
+    sorter.update(baseIndex, *students[baseIndex]);
+
+    if (!activeSortKeys.empty()) {
+        const int position = sortedPosition(baseIndex, row);
+        const int destination = position < row ? position : position + 1;
+        if (destination != row && destination != row + 1) {
+            beginMoveRows(QModelIndex(), row, row, QModelIndex(), destination);
+            order.erase(order.begin() + row);
+            order.insert(order.begin() + position, baseIndex);
+            endMoveRows();
+            row = position;
+        }
+    }
+    emit dataChanged(index(row, 0), index(row, columnCount() - 1));
+    return row;
+}
+
+void StudentTableModel::replaceStudent(int row, const std::shared_ptr<Student>& student) {
+    if (row < 0 || row >= static_cast<int>(order.size()) || !student) return;
+    students[order[row]] = student;
+    refreshStudent(row);
+}
+
+void StudentTableModel::replaceStudents(const std::vector<StudentReplacement>& replacements) {
+    if (replacements.empty() || students.empty()) return;
+    std::unordered_map<const Student*, std::shared_ptr<Student>> current;
+    current.reserve(replacements.size());
+    for (const auto& [previous, student] : replacements) {
+        current.emplace(previous.get(), student);
+    }
+
+    std::vector<int> replaced;
+    for (std::size_t i = 0; i < students.size(); ++i) {
+        if (auto it = current.find(students[i].get()); it != current.end()) {
+            students[i] = it->second;
+            replaced.push_back(static_cast<int>(i));
+        }
+    }
+    if (replaced.empty()) return;
+
+    if (replaced.size() <= kIncrementalChangeLimit) {
+        std::unordered_map<int, int> rowOfBase;
+        rowOfBase.reserve(replaced.size());
+        for (int baseIndex : replaced) {
+            rowOfBase.emplace(baseIndex, -1);
+        }
+        for (int row = 0; row < static_cast<int>(order.size()); ++row) {
+            if (auto it = rowOfBase.find(order[row]); it != rowOfBase.end()) it->second = row;
+        }
+        std::vector<int> rows;
+        rows.reserve(replaced.size());
+        for (int baseIndex : replaced) {
+            rows.push_back(rowOfBase[baseIndex]);
+        }
+
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            const int from = rows[i];
+            const int to = refreshRow(from);
+            if (from == to) continue;
+            for (std::size_t j = i + 1; j < rows.size(); ++j) {
+                rows[j] -= rows[j] > from ? 1 : 0;
+                rows[j] += rows[j] >= to ? 1 : 0;
+            }
+        }
+        return;
+    }
+    for (int baseIndex : replaced) {
+        sorter.update(baseIndex, *students[baseIndex]);
+    }
+    if (!activeSortKeys.empty()) {
+        resort();
+    }
+    emit dataChanged(index(0, 0), index(rowCount() - 1, columnCount() - 1));
+}
+
+void StudentTableModel::removeStudents(const std::vector<std::shared_ptr<Student>>& removed) {
+    if (removed.empty() || students.empty()) return;
+    std::unordered_set<const Student*> targets;
+    targets.reserve(removed.size());
+    for (const auto& student : removed) {
+        targets.insert(student.get());
+    }
+
+    std::vector<int> rows;
+    for (int row = 0; row < static_cast<int>(order.size()); ++row) {
+        if (targets.contains(students[order[row]].get())) rows.push_back(row);
+    }
+    if (rows.size() <= kIncrementalChangeLimit) {
+        for (auto row = rows.rbegin(); row != rows.rend(); ++row) {
+            removeStudent(*row);
+        }
+        return;
+    }
+
+    beginResetModel();
+    std::erase_if(students, [&targets](const std::shared_ptr<Student>& student) {
+        return targets.contains(student.get());
+    });
+    sorter.reset();
+    order = sorter.sortedOrder(students, activeSortKeys);
+    endResetModel();
+}
+
+void StudentTableModel::removeStudent(int row) {
+    if (row < 0 || row >= static_cast<int>(order.size())) return;
+    const int baseIndex = order[row];
+    beginRemoveRows(QModelIndex(), row, row);
+    order.erase(order.begin() + row);
+    for (auto& entry : order) {
+        if (entry > baseIndex) --entry;
+    }
+    students.erase(students.begin() + baseIndex);
+    sorter.remove(baseIndex);
+    endRemoveRows();
+}
+
+std::optional<StudentSortField> StudentTableModel::sortFieldFor(Column column) {
+    switch (column) {
+        case Column::Name:
+            return StudentSortField::Name;
+        case Column::Surname:
+            return StudentSortField::Surname;
+        case Column::Course:
+            return StudentSortField::Course;
+        case Column::Semester:
+            return StudentSortField::Semester;
+        case Column::Funding:
+            return StudentSortField::Funding;
+        case Column::AverageGrade:
+            return StudentSortField::AverageGrade;
+        case Column::MissedHours:
+            return StudentSortField::MissedHours;
+        case Column::Social:
+            return StudentSortField::Social;
+        case Column::Scholarship:
+            return StudentSortField::Scholarship;
+        default:
+            return std::nullopt;
+    }
+}
+
+StudentTableModel::Column StudentTableModel::columnFor(StudentSortField field) {
+    switch (field) {
+        case StudentSortField::Name:
+            return Column::Name;
+        case StudentSortField::Surname:
+            return Column::Surname;
+        case StudentSortField::Course:
+            return Column::Course;
+        case StudentSortField::Semester:
+            return Column::Semester;
+        case StudentSortField::Funding:
+            return Column::Funding;
+        case StudentSortField::AverageGrade:
+            return Column::AverageGrade;
+        case StudentSortField::MissedHours:
+            return Column::MissedHours;
+        case StudentSortField::Social:
+            return Column::Social;
+        case StudentSortField::Scholarship:
+            return Column::Scholarship;
+    }
+    return Column::Number;
+}
+
+void StudentTableModel::sort(int column, Qt::SortOrder sortOrder) {
+    auto field = sortFieldFor(columnAt(column));
+    if (!field) {
+        sortBy({});
+        return;
+    }
+    sortBy({StudentSortKey{*field, sortOrder == Qt::AscendingOrder}});
+}
+
+void StudentTableModel::sortBy(const std::vector<StudentSortKey>& keys) {
+    if (keys == activeSortKeys) return;
+    activeSortKeys = keys;
+    resort();
+}
+
+void StudentTableModel::resort() {
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+    const QModelIndexList previousIndexes = persistentIndexList();
+    std::vector<int> previousBase;
+    previousBase.reserve(previousIndexes.size());
+    for (const auto& persistent : previousIndexes) {
+        previousBase.push_back(order[persistent.row()]);
+    }
+
+    order = sorter.sortedOrder(students, activeSortKeys);
+
+    std::vector<int> rowOfBase(order.size());
+    for (int row = 0; row < static_cast<int>(order.size()); ++row) {
+        rowOfBase[order[row]] = row;
+    }
+    QModelIndexList nextIndexes;
+    nextIndexes.reserve(previousIndexes.size());
+    for (int i = 0; i < previousIndexes.size(); ++i) {
+        nextIndexes.append(index(rowOfBase[previousBase[i]], previousIndexes[i].column()));
+    }
+    changePersistentIndexList(previousIndexes, nextIndexes);
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void StudentTableModel::setHighlightedRow(int row) {
+    const int previous = highlightedRow.isValid() ? highlightedRow.row() : -1;
+    if (previous == row) return;
+
+    highlightedRow = (row >= 0 && row < static_cast<int>(order.size()))
+                         ? QPersistentModelIndex(index(row, 0))
+                         : QPersistentModelIndex();
+
+    const QList<int> roles{Qt::BackgroundRole};
+    if (previous >= 0) {
+        emit dataChanged(index(previous, 0), index(previous, columnCount() - 1), roles);
+    }
+    if (highlightedRow.isValid()) {
+        emit dataChanged(index(row, 0), index(row, columnCount() - 1), roles);
+    }
+}
@@ -0,0 +1,15 @@
+#include "managers/studentTransaction.h"
+
+#include <utility>
+
+void StudentTransaction::add(std::shared_ptr<Student> student) {
+    added.push_back(std::move(student));
+}
+
+void StudentTransaction::update(std::shared_ptr<Student> student, StudentMutator mutator) {
+    updates.push_back(Update{std::move(student), std::move(mutator)});
+}
+
+void StudentTransaction::remove(std::shared_ptr<Student> student) {
+    removed.push_back(std::move(student));
+}
@@ -1,26 +1,56 @@
 #include "services/historyGradeGenerator.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <random>
+#include <string_view>
 
 #include "entities/student.h"
 
+namespace {
+std::uint64_t hashText(std::uint64_t hash, std::string_view text) {
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+}
+
 HistoryGradeGenerator::HistoryGradeGenerator() = default;
 
-double HistoryGradeGenerator::generateRandomGrade() const {
-    thread_local static std::random_device rd;
-    thread_local static std::uniform_real_distribution distribution{5.0, 10.0};
-    
-    double value = distribution(rd);
+HistoryGradeGenerator::HistoryGradeGenerator(std::uint64_t seed) : seed(seed) {}
+
+HistoryGradeGenerator::Engine HistoryGradeGenerator::engineForStudent(
+    const Student& student) const {
+    std::uint64_t hash = hashText(0xcbf29ce484222325ULL, student.getSurname());
+    hash = hashText(hash ^ 0xff, student.getName());
+    return Engine(seed ^ SplitMix64::mix(hash));
+}
+
+double HistoryGradeGenerator::nextGrade(Engine& engine) {
+    double value = kMinGrade + (kMaxGrade - kMinGrade) * engine.nextUnit();
     return std::round(value * 100.0) / 100.0;
 }
 
+void HistoryGradeGenerator::generateGrades(Engine& engine, std::span<double> grades) {
+    for (double& grade : grades) {
+        grade = nextGrade(engine);
+    }
+}
+
 void HistoryGradeGenerator::ensureHistoryForNewStudent(Student& student, int currentSemester) const {
+    student.setHistoryMaterialized(true);
     if (currentSemester <= 1) return;
+
+    std::array<double, 8> grades{};
+    auto engine = engineForStudent(student);
+    generateGrades(engine, std::span(grades).first(std::min<std::size_t>(currentSemester - 1, 8)));
+
     const auto& existingHistory = student.getPreviousSemesterGrades();
-    for (int sem = 1; sem < currentSemester; ++sem) {
+    for (int sem = 1; sem < currentSemester && sem <= 8; ++sem) {
         if (!existingHistory.contains(sem)) {
-            student.addPreviousGrade(sem, generateRandomGrade());
+            student.addPreviousGrade(sem, grades[sem - 1]);
         }
     }
 }
@@ -33,10 +63,7 @@ void HistoryGradeGenerator::handleSemesterChange(Student& student, int oldSemest
     ensureHistoryForNewStudent(student, newSemester);
 }
 
-void HistoryGradeGenerator::fillMissingHistoryForAll(
-    const std::vector<std::shared_ptr<Student>>& students) const {
-    for (const auto& student : students) {
-        if (!student) continue;
-        ensureHistoryForNewStudent(*student, student->getSemester());
-    }
+void HistoryGradeGenerator::materializeHistory(Student& student) const {
+    if (student.isHistoryMaterialized()) return;
+    ensureHistoryForNewStudent(student, student.getSemester());
 }
@@ -0,0 +1,187 @@
+#include "services/semesterStatisticsCalculator.h"
+
+#include <algorithm>
+#include <ranges>
+
+#include "diagnostics/traceRecorder.h"
+#include "entities/student.h"
+#include "services/scholarshipCalculator.h"
+#include "services/taskScheduler.h"
+
+std::map<int, SemesterStatisticsCalculator::YearStats> SemesterStatisticsCalculator::calculate(
+    const std::vector<std::shared_ptr<Student>>& students) const {
+    TRACE_SCOPE("SemesterStatisticsCalculator::calculate", "statistics");
+    std::map<int, YearStats> yearStats;
+    for (int year = 2022; year <= 2025; ++year) {
+        yearStats[year] = YearStats{};
+    }
+
+    std::vector<std::map<int, YearStats>> partials((students.size() + kParallelGrain - 1) /
+                                                   kParallelGrain);
+    TaskScheduler::instance().parallelFor(
+        students.size(), kParallelGrain, [&](std::size_t begin, std::size_t end) {
+            auto& partial = partials[begin / kParallelGrain];
+            for (std::size_t i = begin; i < end; ++i) {
+                if (students[i]) accumulate(students[i], partial);
+            }
+        });
+
+    for (const auto& partial : partials) {
+        for (const auto& [year, stats] : partial) {
+            auto& total = yearStats[year];
+            total.winterCount += stats.winterCount;
+            total.summerCount += stats.summerCount;
+            total.winterTotal += stats.winterTotal;
+            total.summerTotal += stats.summerTotal;
+        }
+    }
+
+    return yearStats;
+}
+
+void SemesterStatisticsCalculator::accumulate(const std::shared_ptr<Student>& student,
+                                              std::map<int, YearStats>& yearStats) const {
+    if (!student->isHistoryMaterialized()) {
+        auto local = std::make_shared<Student>(*student);
+        historyGenerator.materializeHistory(*local);
+        accumulate(local, yearStats);
+        return;
+    }
+
+    std::set<int> allSemesters = collectAllSemesters(student);
+    int currentSem = student->getSemester();
+
+    for (int year = 2022; year <= 2025; ++year) {
+        std::vector<int> yearSemesters = getYearSemesters(year);
+
+        if (!wasStudentInYear(allSemesters, yearSemesters)) {
+            continue;
+        }
+
+        auto& stats = yearStats[year];
+        stats.winterCount += 1;
+        stats.winterTotal += calculateWinterScholarship(student, year, yearSemesters, currentSem);
+
+        if (wasOnSummerSemester(allSemesters, yearSemesters)) {
+            stats.summerCount += 1;
+            stats.summerTotal += calculateSummerScholarship(student, year, yearSemesters, currentSem);
+        }
+    }
+}
+
+SemesterStatisticsCalculator::GeneralStats SemesterStatisticsCalculator::summarize(
+    const std::vector<std::shared_ptr<Student>>& students) {
+    GeneralStats stats;
+    for (const auto& student : students) {
+        if (!student) continue;
+        ++stats.total;
+        if (student->getIsBudget()) {
+            ++stats.budget;
+        } else {
+            ++stats.paid;
+        }
+        stats.totalScholarship += student->getScholarship();
+    }
+    return stats;
+}
+
+std::set<int> SemesterStatisticsCalculator::collectAllSemesters(const std::shared_ptr<Student>& student) const {
+    std::set<int> allSemesters;
+    allSemesters.insert(student->getSemester());
+    const auto& history = student->getPreviousSemesterGrades();
+    for (const auto& [sem, grade] : history) {
+        allSemesters.insert(sem);
+    }
+    return allSemesters;
+}
+
+std::vector<int> SemesterStatisticsCalculator::getYearSemesters(int year) const {
+    std::vector<int> yearSemesters;
+    for (int sem = 1; sem <= 8; ++sem) {
+        if (getYearForSemester(sem) == year) {
+            yearSemesters.push_back(sem);
+        }
+    }
+    return yearSemesters;
+}
+
+bool SemesterStatisticsCalculator::wasStudentInYear(const std::set<int>& allSemesters,
+                                                const std::vector<int>& yearSemesters) const {
+    return std::ranges::any_of(yearSemesters, [&allSemesters](int sem) {
+        return allSemesters.contains(sem);
+    });
+}
+
+bool SemesterStatisticsCalculator::wasOnSummerSemester(const std::set<int>& allSemesters,
+                                                   const std::vector<int>& yearSemesters) const {
+    return std::ranges::any_of(yearSemesters, [&allSemesters](int sem) {
+        return sem % 2 == 0 && allSemesters.contains(sem);
+    });
+}
+
+double SemesterStatisticsCalculator::getScholarshipFromHistory(const std::shared_ptr<Student>& student,
+                                                           int sem) const {
+    const auto& scholarshipHistory = student->getPreviousSemesterScholarships();
+    if (auto scholarshipIt = scholarshipHistory.find(sem); scholarshipIt != scholarshipHistory.end()) {
+        return scholarshipIt->second;
+    }
+    if (int budgetSem = student->getBudgetSemester(); budgetSem > 0 && sem >= budgetSem) {
+        const auto& history = student->getPreviousSemesterGrades();
+        if (auto it = history.find(sem); it != history.end()) {
+            return ScholarshipCalculator::calculateScholarship(it->second);
+        }
+    }
+    return 0.0;
+}
+
+double SemesterStatisticsCalculator::calculateWinterScholarship(const std::shared_ptr<Student>& student,
+                                                           int year, const std::vector<int>& yearSemesters,
+                                                           int currentSem) const {
+    int budgetSem = student->getBudgetSemester();
+    if (budgetSem <= 0) {
+        return 0.0;
+    }
+    
+    if (getYearForSemester(currentSem) == year) {
+        if (student->getIsBudget() && currentSem >= budgetSem && student->getMissedHours() < 12) {
+            return student->getScholarship();
+        }
+        return 0.0;
+    }
+    
+    for (int sem : yearSemesters) {
+        if (sem >= budgetSem) {
+            return getScholarshipFromHistory(student, sem);
+        }
+    }
+    return 0.0;
+}
+
+double SemesterStatisticsCalculator::calculateSummerScholarship(const std::shared_ptr<Student>& student,
+                                                           int year, const std::vector<int>& yearSemesters,
+                                                           int currentSem) const {
+    int budgetSem = student->getBudgetSemester();
+    if (budgetSem <= 0) {
+        return 0.0;
+    }
+    
+    for (int sem : yearSemesters) {
+        if (sem % 2 != 0 || sem < budgetSem) {
+            continue;
+        }
+        
+        if (sem == currentSem && getYearForSemester(currentSem) == year) {
+            if (student->getIsBudget() && student->getMissedHours() < 12) {
+                return student->getScholarship();
+            }
+            return 0.0;
+        }
+        
+        return getScholarshipFromHistory(student, sem);
+    }
+    return 0.0;
+}
+
+int SemesterStatisticsCalculator::getYearForSemester(int semester) const {
+    return 2026 - ((semester + 1) / 2);
+}
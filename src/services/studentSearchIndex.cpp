@@ -0,0 +1,135 @@
+#include "services/studentSearchIndex.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "diagnostics/traceRecorder.h"
+#include "entities/student.h"
+
+namespace {
+constexpr int kStopCheckInterval = 4096;
+}
+
+StudentSearchIndex::StudentSearchIndex() : entries(std::make_shared<std::vector<Entry>>()) {}
+
+QString StudentSearchIndex::fold(const QString& text) { return text.toCaseFolded(); }
+
+QString StudentSearchIndex::keyFor(const Student& student) {
+    return fold(QString::fromStdString(student.getFullName()));
+}
+
+std::vector<StudentSearchIndex::Entry>& StudentSearchIndex::mutableEntries() {
+    if (entries.use_count() > 1) {
+        entries = std::make_shared<std::vector<Entry>>(*entries);
+    }
+    ++currentVersion;
+    return *entries;
+}
+
+void StudentSearchIndex::rebuild(const std::vector<std::shared_ptr<Student>>& students) {
+    auto rebuilt = std::make_shared<std::vector<Entry>>();
+    rebuilt->reserve(students.size());
+    for (const auto& student : students) {
+        if (student) {
+            rebuilt->push_back(Entry{keyFor(*student), student});
+        }
+    }
+    entries = std::move(rebuilt);
+    ++currentVersion;
+}
+
+void StudentSearchIndex::add(const std::shared_ptr<Student>& student) {
+    if (!student) return;
+    mutableEntries().push_back(Entry{keyFor(*student), student});
+}
+
+void StudentSearchIndex::add(const std::vector<std::shared_ptr<Student>>& students) {
+    auto& list = mutableEntries();
+    list.reserve(list.size() + students.size());
+    for (const auto& student : students) {
+        if (student) {
+            list.push_back(Entry{keyFor(*student), student});
+        }
+    }
+}
+
+void StudentSearchIndex::update(const std::shared_ptr<Student>& student) {
+    if (!student) return;
+    auto& list = mutableEntries();
+    auto it = std::ranges::find(list, student, &Entry::student);
+    if (it != list.end()) {
+        it->key = keyFor(*student);
+    }
+}
+
+void StudentSearchIndex::replace(const std::vector<StudentReplacement>& replacements) {
+    if (replacements.empty()) return;
+    std::unordered_map<const Student*, const std::shared_ptr<Student>*> current;
+    current.reserve(replacements.size());
+    for (const auto& replacement : replacements) {
+        current.emplace(replacement.previous.get(), &replacement.current);
+    }
+
+    for (auto& entry : mutableEntries()) {
+        if (auto it = current.find(entry.student.get()); it != current.end()) {
+            entry.student = *it->second;
+            entry.key = keyFor(*entry.student);
+        }
+    }
+}
+
+void StudentSearchIndex::remove(const std::shared_ptr<Student>& student) {
+    if (!student) return;
+    auto& list = mutableEntries();
+    std::erase_if(list, [&student](const Entry& entry) { return entry.student == student; });
+}
+
+void StudentSearchIndex::remove(const std::vector<std::shared_ptr<Student>>& students) {
+    if (students.empty()) return;
+    std::unordered_set<const Student*> removed;
+    removed.reserve(students.size());
+    for (const auto& student : students) {
+        removed.insert(student.get());
+    }
+    std::erase_if(mutableEntries(), [&removed](const Entry& entry) {
+        return removed.contains(entry.student.get());
+    });
+}
+
+std::optional<std::vector<int>> StudentSearchIndex::search(const std::vector<Entry>& entries,
+                                                           const QString& foldedQuery,
+                                                           const std::vector<int>* candidates,
+                                                           std::stop_token stopToken) {
+    TRACE_SCOPE("StudentSearchIndex::search", "search");
+    std::vector<int> matches;
+    auto matchesQuery = [&entries, &foldedQuery](int index) {
+        return entries[index].key.contains(foldedQuery);
+    };
+
+    const int total = candidates ? static_cast<int>(candidates->size())
+                                 : static_cast<int>(entries.size());
+    for (int i = 0; i < total; ++i) {
+        if (i % kStopCheckInterval == 0 && stopToken.stop_requested()) {
+            return std::nullopt;
+        }
+        int index = candidates ? (*candidates)[i] : i;
+        if (matchesQuery(index)) {
+            matches.push_back(index);
+        }
+    }
+    return matches;
+}
+
+MemoryFootprint StudentSearchIndex::memoryFootprint() const {
+    using namespace memoryEstimate;
+    MemoryFootprint footprint;
+    footprint.studentCount = entries->size();
+    std::size_t keyBytes = 0;
+    for (const auto& entry : *entries) {
+        keyBytes += heapBlockBytes(sizeof(QArrayData) + sizeof(QChar) * (entry.key.capacity() + 1));
+    }
+    footprint.add("search index", vectorBytes(*entries));
+    footprint.add("search keys", keyBytes);
+    return footprint;
+}
@@ -0,0 +1,234 @@
+#include "services/studentSorter.h"
+
+#include <QLocale>
+#include <QString>
+#include <algorithm>
+#include <numeric>
+
+#include "diagnostics/traceRecorder.h"
+#include "entities/student.h"
+#include "services/taskScheduler.h"
+
+namespace {
+constexpr std::size_t kSortKeyPrivateBytes = 32;
+
+template <typename Less>
+void parallelSort(std::vector<int>& order, const Less& less) {
+    auto& scheduler = TaskScheduler::instance();
+    const std::size_t size = order.size();
+    const std::size_t workers = std::max(2u, scheduler.workerCount());
+    const std::size_t chunk = (size + workers - 1) / workers;
+
+    scheduler.parallelFor(size, chunk, [&order, &less](std::size_t begin, std::size_t end) {
+        std::sort(order.begin() + begin, order.begin() + end, less);
+    });
+
+    for (std::size_t width = chunk; width < size; width *= 2) {
+        const std::size_t merges = (size + 2 * width - 1) / (2 * width);
+        scheduler.parallelFor(merges, 1, [&order, &less, size, width](std::size_t first,
+                                                                      std::size_t last) {
+            for (std::size_t merge = first; merge < last; ++merge) {
+                std::size_t low = merge * 2 * width;
+                std::size_t middle = std::min(low + width, size);
+                std::size_t high = std::min(low + 2 * width, size);
+                std::inplace_merge(order.begin() + low, order.begin() + middle,
+                                   order.begin() + high, less);
+            }
+        });
+    }
+}
+}
+
+StudentSorter::StudentSorter() : collator(QLocale()) {
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    collator.setNumericMode(true);
+}
+
+bool StudentSorter::isTextField(StudentSortField field) {
+    return field == StudentSortField::Name || field == StudentSortField::Surname;
+}
+
+double StudentSorter::numericValue(const Student& student, StudentSortField field) {
+    switch (field) {
+        case StudentSortField::Course:
+            return student.getCourse();
+        case StudentSortField::Semester:
+            return student.getSemester();
+        case StudentSortField::Funding:
+            return student.getIsBudget() ? 0.0 : 1.0;
+        case StudentSortField::AverageGrade:
+            return student.getAverageGrade();
+        case StudentSortField::MissedHours:
+            return student.getMissedHours();
+        case StudentSortField::Social:
+            return student.getHasSocialScholarship() ? 1.0 : 0.0;
+        case StudentSortField::Scholarship:
+            return student.getScholarship();
+        default:
+            return 0.0;
+    }
+}
+
+QCollatorSortKey StudentSorter::textKey(const Student& student, StudentSortField field) const {
+    const auto& text =
+        field == StudentSortField::Name ? student.getName() : student.getSurname();
+    return collator.sortKey(QString::fromStdString(text));
+}
+
+void StudentSorter::reset() {
+    count = 0;
+    textKeys.clear();
+    numericKeys.clear();
+    invalidateOrders();
+}
+
+void StudentSorter::append(const Student& student) {
+    ++count;
+    for (auto& [field, keys] : textKeys) {
+        keys.push_back(textKey(student, field));
+    }
+    for (auto& [field, keys] : numericKeys) {
+        keys.push_back(numericValue(student, field));
+    }
+    invalidateOrders();
+}
+
+void StudentSorter::update(std::size_t index, const Student& student) {
+    if (index >= count) return;
+    for (auto& [field, keys] : textKeys) {
+        keys[index] = textKey(student, field);
+    }
+    for (auto& [field, keys] : numericKeys) {
+        keys[index] = numericValue(student, field);
+    }
+    invalidateOrders();
+}
+
+void StudentSorter::remove(std::size_t index) {
+    if (index >= count) return;
+    --count;
+    for (auto& [field, keys] : textKeys) {
+        keys.erase(keys.begin() + index);
+    }
+    for (auto& [field, keys] : numericKeys) {
+        keys.erase(keys.begin() + index);
+    }
+    invalidateOrders();
+}
+
+void StudentSorter::prepare(const Students& students, const std::vector<StudentSortKey>& keys) {
+    if (count != students.size()) {
+        reset();
+        count = students.size();
+    }
+
+    for (const auto& key : keys) {
+        if (isTextField(key.field)) {
+            if (textKeys.contains(key.field)) continue;
+            auto& column = textKeys[key.field];
+            column.reserve(students.size());
+            for (const auto& student : students) {
+                column.push_back(textKey(*student, key.field));
+            }
+        } else {
+            if (numericKeys.contains(key.field)) continue;
+            auto& column = numericKeys[key.field];
+            column.reserve(students.size());
+            for (const auto& student : students) {
+                column.push_back(numericValue(*student, key.field));
+            }
+        }
+    }
+}
+
+int StudentSorter::compareField(StudentSortField field, int lhs, int rhs) const {
+    if (isTextField(field)) {
+        const auto& keys = textKeys.at(field);
+        return keys[lhs].compare(keys[rhs]);
+    }
+    const auto& keys = numericKeys.at(field);
+    return (keys[lhs] > keys[rhs]) - (keys[lhs] < keys[rhs]);
+}
+
+bool StudentSorter::less(const std::vector<StudentSortKey>& keys, int lhs, int rhs) const {
+    for (const auto& key : keys) {
+        int result = compareField(key.field, lhs, rhs);
+        if (result != 0) {
+            return key.ascending ? result < 0 : result > 0;
+        }
+    }
+    return lhs < rhs;
+}
+
+std::vector<int> StudentSorter::sortedOrder(const Students& students,
+                                            const std::vector<StudentSortKey>& keys) {
+    TRACE_SCOPE("StudentSorter::sortedOrder", "table");
+    prepare(students, keys);
+    if (auto it = cachedOrders.find(keys); it != cachedOrders.end()) {
+        return it->second;
+    }
+
+    std::vector<int> order(students.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (!keys.empty()) {
+        auto compare = [this, &keys](int lhs, int rhs) { return less(keys, lhs, rhs); };
+        if (order.size() >= kParallelThreshold) {
+            parallelSort(order, compare);
+        } else {
+            std::ranges::sort(order, compare);
+        }
+    }
+
+    if (cachedOrders.size() >= kCachedOrderLimit) {
+        cachedOrders.clear();
+    }
+    cachedOrders[keys] = order;
+    return order;
+}
+
+MemoryFootprint StudentSorter::memoryFootprint(const Students& students,
+                                               MemoryFootprint::Mode mode) const {
+    using namespace memoryEstimate;
+    if (!allocationCountingEnabled()) {
+        mode = MemoryFootprint::Mode::Estimate;
+    }
+    MemoryFootprint footprint;
+    footprint.mode = mode;
+    footprint.studentCount = students.size();
+
+    std::size_t textBytes = 0;
+    for (const auto& [field, keys] : textKeys) {
+        if (mode == MemoryFootprint::Mode::Exact && keys.size() == students.size()) {
+            textBytes += measureLiveBytes([&, field] {
+                std::vector<QCollatorSortKey> rebuilt;
+                rebuilt.reserve(keys.capacity());
+                for (const auto& student : students) {
+                    rebuilt.push_back(textKey(*student, field));
+                }
+                return rebuilt;
+            });
+            continue;
+        }
+        textBytes += vectorBytes(keys);
+        for (const auto& student : students) {
+            const auto& text =
+                field == StudentSortField::Name ? student->getName() : student->getSurname();
+            textBytes += heapBlockBytes(kSortKeyPrivateBytes) + heapBlockBytes(2 * text.size());
+        }
+    }
+
+    std::size_t numericBytes = 0;
+    for (const auto& [field, keys] : numericKeys) {
+        numericBytes += vectorBytes(keys);
+    }
+
+    std::size_t orderBytes = 0;
+    for (const auto& [keys, order] : cachedOrders) {
+        orderBytes += vectorBytes(keys) + vectorBytes(order) + heapBlockBytes(kMapNodeHeaderBytes);
+    }
+
+    footprint.add("sort keys (text)", textBytes);
+    footprint.add("sort keys (numeric)", numericBytes);
+    footprint.add("cached sort orders", orderBytes);
+    return footprint;
+}
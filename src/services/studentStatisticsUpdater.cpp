@@ -6,9 +6,8 @@
 #include <QTableWidget>
 #include <QTableWidgetItem>
 #include <ranges>
-#include <set>
 
-#include "services/scholarshipCalculator.h"
+#include "diagnostics/traceRecorder.h"
 #include "entities/student.h"
 
 void StudentStatisticsUpdater::updateGeneralStatistics(
@@ -17,129 +16,21 @@ void StudentStatisticsUpdater::updateGeneralStatistics(
     QLabel* budgetLabel,
     QLabel* paidLabel,
     QLabel* totalScholarshipLabel) const {
+    TRACE_SCOPE("StudentStatisticsUpdater::updateGeneralStatistics", "statistics");
     if (!totalLabel || !budgetLabel || !paidLabel || !totalScholarshipLabel) return;
 
-    size_t total = students.size();
-    size_t budget = 0;
-    size_t paid = 0;
-    double totalScholarship = 0.0;
+    auto stats = SemesterStatisticsCalculator::summarize(students);
 
-    for (const auto& student : students) {
-        if (!student) continue;
-        if (student->getIsBudget()) {
-            budget++;
-        } else {
-            paid++;
-        }
-        totalScholarship += student->getScholarship();
-    }
-
-    totalLabel->setText(QString("Total Students: %1").arg(total));
-    budgetLabel->setText(QString("Budget Students: %1").arg(budget));
-    paidLabel->setText(QString("Paid Students: %1").arg(paid));
+    totalLabel->setText(QString("Total Students: %1").arg(stats.total));
+    budgetLabel->setText(QString("Budget Students: %1").arg(stats.budget));
+    paidLabel->setText(QString("Paid Students: %1").arg(stats.paid));
     totalScholarshipLabel->setText(
-        QString("Total Scholarships: %1 BYN").arg(totalScholarship, 0, 'f', 2));
-}
-
-std::set<int> StudentStatisticsUpdater::collectAllSemesters(const std::shared_ptr<Student>& student) const {
-    std::set<int> allSemesters;
-    allSemesters.insert(student->getSemester());
-    const auto& history = student->getPreviousSemesterGrades();
-    for (const auto& [sem, grade] : history) {
-        allSemesters.insert(sem);
-    }
-    return allSemesters;
-}
-
-std::vector<int> StudentStatisticsUpdater::getYearSemesters(int year) const {
-    std::vector<int> yearSemesters;
-    for (int sem = 1; sem <= 8; ++sem) {
-        if (getYearForSemester(sem) == year) {
-            yearSemesters.push_back(sem);
-        }
-    }
-    return yearSemesters;
-}
-
-bool StudentStatisticsUpdater::wasStudentInYear(const std::set<int>& allSemesters,
-                                                const std::vector<int>& yearSemesters) const {
-    return std::ranges::any_of(yearSemesters, [&allSemesters](int sem) {
-        return allSemesters.contains(sem);
-    });
-}
-
-bool StudentStatisticsUpdater::wasOnSummerSemester(const std::set<int>& allSemesters,
-                                                   const std::vector<int>& yearSemesters) const {
-    return std::ranges::any_of(yearSemesters, [&allSemesters](int sem) {
-        return sem % 2 == 0 && allSemesters.contains(sem);
-    });
-}
-
-double StudentStatisticsUpdater::getScholarshipFromHistory(const std::shared_ptr<Student>& student,
-                                                           int sem) const {
-    const auto& scholarshipHistory = student->getPreviousSemesterScholarships();
-    if (auto scholarshipIt = scholarshipHistory.find(sem); scholarshipIt != scholarshipHistory.end()) {
-        return scholarshipIt->second;
-    }
-    if (int budgetSem = student->getBudgetSemester(); budgetSem > 0 && sem >= budgetSem) {
-        const auto& history = student->getPreviousSemesterGrades();
-        if (auto it = history.find(sem); it != history.end()) {
-            return ScholarshipCalculator::calculateScholarship(it->second);
-        }
-    }
-    return 0.0;
-}
-
-double StudentStatisticsUpdater::calculateWinterScholarship(const std::shared_ptr<Student>& student,
-                                                           int year, const std::vector<int>& yearSemesters,
-                                                           int currentSem) const {
-    int budgetSem = student->getBudgetSemester();
-    if (budgetSem <= 0) {
-        return 0.0;
-    }
-    
-    if (getYearForSemester(currentSem) == year) {
-        if (student->getIsBudget() && currentSem >= budgetSem && student->getMissedHours() < 12) {
-            return student->getScholarship();
-        }
-        return 0.0;
-    }
-    
-    for (int sem : yearSemesters) {
-        if (sem >= budgetSem) {
-            return getScholarshipFromHistory(student, sem);
-        }
-    }
-    return 0.0;
-}
-
-double StudentStatisticsUpdater::calculateSummerScholarship(const std::shared_ptr<Student>& student,
-                                                           int year, const std::vector<int>& yearSemesters,
-                                                           int currentSem) const {
-    int budgetSem = student->getBudgetSemester();
-    if (budgetSem <= 0) {
-        return 0.0;
-    }
-    
-    for (int sem : yearSemesters) {
-        if (sem % 2 != 0 || sem < budgetSem) {
-            continue;
-        }
-        
-        if (sem == currentSem && getYearForSemester(currentSem) == year) {
-            if (student->getIsBudget() && student->getMissedHours() < 12) {
-                return student->getScholarship();
-            }
-            return 0.0;
-        }
-        
-        return getScholarshipFromHistory(student, sem);
-    }
-    return 0.0;
+        QString("Total Scholarships: %1 BYN").arg(stats.totalScholarship, 0, 'f', 2));
 }
 
-void StudentStatisticsUpdater::populateTableRows(QTableWidget* table,
-                                                 const std::map<int, YearStats>& yearStats) const {
+void StudentStatisticsUpdater::populateTableRows(
+    QTableWidget* table,
+    const std::map<int, SemesterStatisticsCalculator::YearStats>& yearStats) const {
     QColor defaultTextColor(234, 234, 234);
     QFont itemFont;
     itemFont.setPointSize(11);
@@ -218,44 +109,11 @@ void StudentStatisticsUpdater::populateTableRows(QTableWidget* table,
 
 void StudentStatisticsUpdater::updateSemesterTable(
     const std::vector<std::shared_ptr<Student>>& students, QTableWidget* table) const {
+    TRACE_SCOPE("StudentStatisticsUpdater::updateSemesterTable", "statistics");
     if (!table) return;
 
     table->setRowCount(0);
-
-    std::map<int, YearStats> yearStats;
-    for (int year = 2022; year <= 2025; ++year) {
-        yearStats[year] = YearStats{};
-    }
-
-    for (const auto& student : students) {
-        if (!student) continue;
-        
-        std::set<int> allSemesters = collectAllSemesters(student);
-        int currentSem = student->getSemester();
-
-        for (int year = 2022; year <= 2025; ++year) {
-            std::vector<int> yearSemesters = getYearSemesters(year);
-            
-            if (!wasStudentInYear(allSemesters, yearSemesters)) {
-                continue;
-            }
-
-            auto& stats = yearStats[year];
-            stats.winterCount += 1;
-            stats.winterTotal += calculateWinterScholarship(student, year, yearSemesters, currentSem);
-
-            if (wasOnSummerSemester(allSemesters, yearSemesters)) {
-                stats.summerCount += 1;
-                stats.summerTotal += calculateSummerScholarship(student, year, yearSemesters, currentSem);
-            }
-        }
-    }
-
-    populateTableRows(table, yearStats);
-}
-
-int StudentStatisticsUpdater::getYearForSemester(int semester) const {
-    return 2026 - ((semester + 1) / 2);
+    populateTableRows(table, calculator.calculate(students));
 }
 
 int StudentStatisticsUpdater::getYearForSemester(int semester, int admissionYear) const {
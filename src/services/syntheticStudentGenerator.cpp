@@ -0,0 +1,125 @@
+#include "services/syntheticStudentGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "entities/student.h"
+
+namespace {
+constexpr std::array<std::string_view, 24> kNames = {
+    "Alexander", "Maxim",  "Ivan",   "Artem",  "Dmitry", "Nikita", "Mikhail", "Egor",
+    "Andrey",    "Kirill", "Ilya",   "Pavel",  "Anna",   "Maria",  "Sofia",   "Daria",
+    "Polina",    "Alina",  "Victoria", "Elena", "Ksenia", "Olga",  "Yulia",   "Natalia"};
+
+constexpr std::array<std::string_view, 24> kSurnames = {
+    "Ivanov",   "Petrov",   "Sidorov",  "Smirnov",  "Kuznetsov", "Popov",
+    "Vasiliev", "Sokolov",  "Mikhailov", "Novikov", "Fedorov",   "Morozov",
+    "Volkov",   "Alekseev", "Lebedev",  "Semenov",  "Egorov",    "Pavlov",
+    "Kozlov",   "Stepanov", "Nikolaev", "Orlov",    "Andreev",   "Makarov"};
+
+using Engine = HistoryGradeGenerator::Engine;
+
+constexpr double kPoissonKnuthLimit = 30.0;
+
+int nextSemester(Engine& engine, const std::array<double, 8>& weights, double totalWeight) {
+    double target = engine.nextUnit() * totalWeight;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        if (target < weights[i]) return static_cast<int>(i) + 1;
+        target -= weights[i];
+    }
+    auto last = std::ranges::find_if(weights.rbegin(), weights.rend(),
+                                     [](double weight) { return weight > 0.0; });
+    return static_cast<int>(weights.rend() - last);
+}
+
+double nextStandardNormal(Engine& engine) {
+    const double radius = std::sqrt(-2.0 * std::log(1.0 - engine.nextUnit()));
+    return radius * std::cos(2.0 * std::numbers::pi * engine.nextUnit());
+}
+
+int nextPoisson(Engine& engine, double mean) {
+    if (mean <= 0.0) return 0;
+    if (mean > kPoissonKnuthLimit) {
+        return static_cast<int>(
+            std::max(0.0, std::round(mean + std::sqrt(mean) * nextStandardNormal(engine))));
+    }
+    const double limit = std::exp(-mean);
+    int count = 0;
+    for (double product = engine.nextUnit(); product > limit; product *= engine.nextUnit()) {
+        ++count;
+    }
+    return count;
+}
+}
+
+void SyntheticStudentProfile::validate() const {
+    double totalWeight = 0.0;
+    for (double weight : semesterWeights) {
+        if (!std::isfinite(weight) || weight < 0.0) {
+            throw std::invalid_argument("Semester weights must be finite and non-negative");
+        }
+        totalWeight += weight;
+    }
+    if (totalWeight <= 0.0) {
+        throw std::invalid_argument("At least one semester weight must be positive");
+    }
+    if (!(budgetShare >= 0.0 && budgetShare <= 1.0) ||
+        !(socialShare >= 0.0 && socialShare <= 1.0)) {
+        throw std::invalid_argument("Budget and social shares must be between 0 and 1");
+    }
+    if (!std::isfinite(gradeMean)) {
+        throw std::invalid_argument("Grade mean must be finite");
+    }
+    if (!std::isfinite(gradeStdDev) || gradeStdDev <= 0.0) {
+        throw std::invalid_argument("Grade standard deviation must be positive");
+    }
+    if (!std::isfinite(missedHoursMean) || missedHoursMean < 0.0) {
+        throw std::invalid_argument("Missed hours mean must be non-negative");
+    }
+}
+
+SyntheticStudentGenerator::SyntheticStudentGenerator(SyntheticStudentProfile profile,
+                                                     std::uint64_t seed)
+    : profile(profile), seed(seed), historyGenerator(seed) {
+    this->profile.validate();
+    totalSemesterWeight = std::accumulate(this->profile.semesterWeights.begin(),
+                                          this->profile.semesterWeights.end(), 0.0);
+}
+
+std::shared_ptr<Student> SyntheticStudentGenerator::generate(std::uint64_t index) const {
+    HistoryGradeGenerator::Engine engine(seed ^ SplitMix64::mix(index));
+
+    std::string name(kNames[engine() % kNames.size()]);
+    std::string surname(kSurnames[engine() % kSurnames.size()]);
+    surname += std::to_string(index + 1);
+
+    int semester = nextSemester(engine, profile.semesterWeights, totalSemesterWeight);
+    double grade = std::clamp(profile.gradeMean + profile.gradeStdDev * nextStandardNormal(engine),
+                              0.0, 10.0);
+    grade = std::round(grade * 100.0) / 100.0;
+    bool isBudget = engine.nextUnit() < profile.budgetShare;
+    int course = (semester - 1) / 2 + 1;
+
+    auto student = std::make_shared<Student>(name, surname, course, semester, grade, isBudget);
+    student->setMissedHours(nextPoisson(engine, profile.missedHoursMean));
+    student->setHasSocialScholarship(engine.nextUnit() < profile.socialShare);
+    if (profile.generateHistory) {
+        historyGenerator.materializeHistory(*student);
+    }
+    return student;
+}
+
+std::vector<std::shared_ptr<Student>> SyntheticStudentGenerator::generateRange(
+    std::uint64_t first, std::size_t count) const {
+    std::vector<std::shared_ptr<Student>> students;
+    students.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        students.push_back(generate(first + i));
+    }
+    return students;
+}
@@ -0,0 +1,243 @@
+#include "services/taskScheduler.h"
+
+#include <algorithm>
+#include <format>
+#include <utility>
+
+#include "diagnostics/traceRecorder.h"
+
+namespace {
+thread_local const TaskScheduler* currentScheduler = nullptr;
+thread_local std::size_t currentWorker = 0;
+
+std::atomic<unsigned> instanceWorkerCount{std::thread::hardware_concurrency()};
+
+std::size_t queueIndex(TaskPriority priority) { return static_cast<std::size_t>(priority); }
+}
+
+TaskScheduler::TaskScheduler(unsigned workerCount) {
+    TraceRecorder::instance();
+    workerCount = std::max(1u, workerCount);
+    workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    threads.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        threads.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::scoped_lock lock(stateMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    threads.clear();
+}
+
+TaskScheduler& TaskScheduler::instance() {
+    static TaskScheduler scheduler(instanceWorkerCount.load());
+    return scheduler;
+}
+
+void TaskScheduler::setInstanceWorkerCount(unsigned workerCount) {
+    instanceWorkerCount.store(workerCount);
+}
+
+void TaskScheduler::submit(Task task, TaskPriority priority, std::stop_token stopToken) {
+    if (stopToken.stop_possible()) {
+        task = [task = std::move(task), stopToken]() mutable {
+            if (!stopToken.stop_requested()) {
+                task();
+            }
+        };
+    }
+
+    {
+        std::scoped_lock lock(stateMutex);
+        pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (currentScheduler == this) {
+        auto& worker = *workers[currentWorker];
+        std::scoped_lock lock(worker.mutex);
+        worker.queues[queueIndex(priority)].push_back(std::move(task));
+    } else {
+        std::scoped_lock lock(injectionMutex);
+        injection[queueIndex(priority)].push_back(std::move(task));
+    }
+    wake.notify_one();
+}
+
+std::optional<TaskScheduler::Task> TaskScheduler::takeTask(std::optional<std::size_t> self) {
+    auto claim = [this](std::deque<Task>& queue, bool fromBack) {
+        Task task = fromBack ? std::move(queue.back()) : std::move(queue.front());
+        fromBack ? queue.pop_back() : queue.pop_front();
+        running.fetch_add(1, std::memory_order_relaxed);
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    };
+
+    for (std::size_t priority = 0; priority < kPriorityCount; ++priority) {
+        if (self) {
+            auto& worker = *workers[*self];
+            std::scoped_lock lock(worker.mutex);
+            if (!worker.queues[priority].empty()) {
+                return claim(worker.queues[priority], true);
+            }
+        }
+        {
+            std::scoped_lock lock(injectionMutex);
+            if (!injection[priority].empty()) {
+                return claim(injection[priority], false);
+            }
+        }
+        const std::size_t start = self ? *self + 1 : 0;
+        for (std::size_t offset = 0; offset < workers.size(); ++offset) {
+            std::size_t victim = (start + offset) % workers.size();
+            if (self && victim == *self) continue;
+            auto& worker = *workers[victim];
+            std::unique_lock lock(worker.mutex, std::try_to_lock);
+            if (lock && !worker.queues[priority].empty()) {
+                return claim(worker.queues[priority], false);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void TaskScheduler::runTask(Task& task) {
+    std::exception_ptr failure;
+    try {
+        task();
+    } catch (...) {
+        failure = std::current_exception();
+    }
+
+    bool becameIdle = false;
+    {
+        std::scoped_lock lock(stateMutex);
+        if (failure && !unhandled) {
+            unhandled = failure;
+        }
+        becameIdle = running.fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                     pending.load(std::memory_order_relaxed) == 0;
+    }
+    if (becameIdle) {
+        idle.notify_all();
+    }
+}
+
+void TaskScheduler::workerLoop(std::size_t index) {
+    currentScheduler = this;
+    currentWorker = index;
+    TraceRecorder::instance().setThreadName(std::format("Worker {}", index));
+
+    while (true) {
+        if (auto task = takeTask(index)) {
+            runTask(*task);
+            continue;
+        }
+
+        std::unique_lock lock(stateMutex);
+        wake.wait(lock, [this] { return stopping || pending.load(std::memory_order_relaxed) > 0; });
+        if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+bool TaskScheduler::parallelFor(std::size_t count, std::size_t grain, const RangeBody& body,
+                                TaskPriority priority, std::stop_token stopToken) {
+    if (count == 0) {
+        return !stopToken.stop_requested();
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    const std::size_t chunks = (count + grain - 1) / grain;
+    if (chunks == 1) {
+        if (stopToken.stop_requested()) return false;
+        body(0, count);
+        return true;
+    }
+
+    struct Range {
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+        std::atomic<bool> failed{false};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;
+    };
+    auto range = std::make_shared<Range>();
+
+    // A throwing chunk still counts as done, so the caller never waits forever and no helper
+    // touches body after parallelFor returns; the first exception is rethrown on the caller.
+    auto drain = [range, &body, count, grain, chunks, stopToken] {
+        std::size_t completed = 0;
+        for (std::size_t chunk = range->next.fetch_add(1); chunk < chunks;
+             chunk = range->next.fetch_add(1)) {
+            if (!stopToken.stop_requested() && !range->failed.load(std::memory_order_relaxed)) {
+                std::size_t begin = chunk * grain;
+                try {
+                    body(begin, std::min(begin + grain, count));
+                } catch (...) {
+                    std::scoped_lock lock(range->mutex);
+                    if (!range->error) range->error = std::current_exception();
+                    range->failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            ++completed;
+        }
+        if (completed && range->done.fetch_add(completed) + completed == chunks) {
+            std::scoped_lock lock(range->mutex);
+            range->finished.notify_all();
+        }
+    };
+
+    const std::size_t helpers = std::min<std::size_t>(chunks - 1, workers.size());
+    for (std::size_t i = 0; i < helpers; ++i) {
+        submit(drain, priority);
+    }
+    drain();
+
+    std::unique_lock lock(range->mutex);
+    range->finished.wait(lock, [&range, chunks] { return range->done.load() == chunks; });
+    if (range->error) {
+        std::rethrow_exception(range->error);
+    }
+    return !stopToken.stop_requested();
+}
+
+void TaskScheduler::setMainThreadDispatcher(MainThreadDispatcher dispatcher) {
+    std::scoped_lock lock(dispatcherMutex);
+    mainThreadDispatcher = std::move(dispatcher);
+}
+
+void TaskScheduler::postToMainThread(MainThreadTask task) {
+    MainThreadDispatcher dispatcher;
+    {
+        std::scoped_lock lock(dispatcherMutex);
+        dispatcher = mainThreadDispatcher;
+    }
+    if (dispatcher) {
+        dispatcher(std::move(task));
+    } else {
+        task();
+    }
+}
+
+void TaskScheduler::waitForIdle() {
+    std::exception_ptr failure;
+    {
+        std::unique_lock lock(stateMutex);
+        idle.wait(lock, [this] {
+            return pending.load(std::memory_order_relaxed) == 0 &&
+                   running.load(std::memory_order_relaxed) == 0;
+        });
+        failure = std::exchange(unhandled, nullptr);
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "entities/student.h"
+#include "managers/studentDatabase.h"
+#include "services/syntheticStudentGenerator.h"
+#include "services/taskScheduler.h"
+
+namespace {
+struct Options {
+    std::uint64_t count = 10000;
+    std::string output = "students.txt";
+    std::uint64_t seed = HistoryGradeGenerator::kDefaultSeed;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t chunkSize = 4096;
+    SyntheticStudentProfile profile;
+};
+
+void printUsage(std::string_view program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --count N              number of students (default 10000)\n"
+              << "  --output FILE          output file (default students.txt)\n"
+              << "  --seed N               random seed\n"
+              << "  --threads N            worker threads (default: hardware concurrency)\n"
+              << "  --chunk N              students per work item (default 4096)\n"
+              << "  --semester-weights W   eight comma separated weights for semesters 1-8\n"
+              << "  --budget-share X       share of budget students, 0..1 (default 0.6)\n"
+              << "  --grade-mean X         mean average grade (default 7.5)\n"
+              << "  --grade-stddev X       average grade standard deviation (default 1.3)\n"
+              << "  --missed-mean X        mean missed hours (default 4)\n"
+              << "  --social-share X       share of students with social support (default 0.05)\n"
+              << "  --no-history           do not generate previous semester grades\n";
+}
+
+template <typename T>
+T parseNumber(std::string_view option, std::string_view text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size()) {
+        throw std::invalid_argument(std::string("Invalid value for ") + std::string(option) +
+                                    ": " + std::string(text));
+    }
+    return value;
+}
+
+double parseShare(std::string_view option, std::string_view text) {
+    double value = parseNumber<double>(option, text);
+    if (value < 0.0 || value > 1.0) {
+        throw std::invalid_argument(std::string(option) + " must be between 0 and 1");
+    }
+    return value;
+}
+
+std::array<double, 8> parseWeights(std::string_view text) {
+    std::array<double, 8> weights{};
+    std::size_t i = 0;
+    while (!text.empty()) {
+        if (i == weights.size()) {
+            throw std::invalid_argument("--semester-weights expects 8 values");
+        }
+        std::size_t comma = text.find(',');
+        weights[i++] = parseNumber<double>("--semester-weights", text.substr(0, comma));
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+    }
+    if (i != weights.size()) {
+        throw std::invalid_argument("--semester-weights expects 8 values");
+    }
+    return weights;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage(argv[0]);
+            std::exit(0);
+        }
+        if (option == "--no-history") {
+            options.profile.generateHistory = false;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument(std::string("Missing value for ") + std::string(option));
+        }
+        std::string_view value = argv[++i];
+        if (option == "--count") {
+            options.count = parseNumber<std::uint64_t>(option, value);
+        } else if (option == "--output") {
+            options.output = value;
+        } else if (option == "--seed") {
+            options.seed = parseNumber<std::uint64_t>(option, value);
+        } else if (option == "--threads") {
+            options.threads = std::max(1u, parseNumber<unsigned>(option, value));
+        } else if (option == "--chunk") {
+            options.chunkSize = std::max<std::size_t>(1, parseNumber<std::size_t>(option, value));
+        } else if (option == "--semester-weights") {
+            options.profile.semesterWeights = parseWeights(value);
+        } else if (option == "--budget-share") {
+            options.profile.budgetShare = parseShare(option, value);
+        } else if (option == "--grade-mean") {
+            options.profile.gradeMean = parseNumber<double>(option, value);
+        } else if (option == "--grade-stddev") {
+            options.profile.gradeStdDev = parseNumber<double>(option, value);
+        } else if (option == "--missed-mean") {
+            options.profile.missedHoursMean = parseNumber<double>(option, value);
+        } else if (option == "--social-share") {
+            options.profile.socialShare = parseShare(option, value);
+        } else {
+            throw std::invalid_argument(std::string("Unknown option: ") + std::string(option));
+        }
+    }
+    options.profile.validate();
+    return options;
+}
+
+std::string renderChunk(const SyntheticStudentGenerator& generator, std::uint64_t first,
+                        std::uint64_t last) {
+    std::string buffer;
+    for (std::uint64_t index = first; index < last; ++index) {
+        auto student = generator.generate(index);
+        StudentDatabase::appendRecord(buffer, *student, index);
+    }
+    return buffer;
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::ofstream file(options.output, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Could not open " << options.output << " for writing\n";
+        return 1;
+    }
+
+    TaskScheduler::setInstanceWorkerCount(options.threads);
+    const auto start = std::chrono::steady_clock::now();
+    SyntheticStudentGenerator generator(options.profile, options.seed);
+    StudentDatabase::writeFileHeader(file, options.count);
+
+    std::uint64_t next = 0;
+    while (next < options.count) {
+        std::vector<std::future<std::string>> chunks;
+        for (unsigned t = 0; t < options.threads && next < options.count; ++t) {
+            std::uint64_t last = std::min<std::uint64_t>(next + options.chunkSize, options.count);
+            chunks.push_back(TaskScheduler::instance().async(
+                [&generator, next, last] { return renderChunk(generator, next, last); }));
+            next = last;
+        }
+        for (auto& chunk : chunks) {
+            file << chunk.get();
+        }
+        if (!file) {
+            std::cerr << "Write to " << options.output << " failed\n";
+            return 1;
+        }
+    }
+
+    StudentDatabase::writeFileFooter(file);
+    file.close();
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Wrote " << options.count << " students to " << options.output << " in "
+              << elapsed.count() << " s\n";
+    return 0;
+}
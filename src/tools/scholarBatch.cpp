@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "entities/student.h"
+#include "exceptions/exceptions.h"
+#include "managers/studentArchive.h"
+#include "managers/studentDatabase.h"
+#include "services/historyGradeGenerator.h"
+#include "services/semesterStatisticsCalculator.h"
+#include "services/taskScheduler.h"
+
+namespace {
+struct Options {
+    std::string input = "students.txt";
+    std::string output;
+    std::string archive;
+    std::uint64_t seed = HistoryGradeGenerator::kDefaultSeed;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool strict = false;
+    bool advanceSemester = false;
+};
+
+void printUsage(std::string_view program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --input FILE     database to process (default students.txt)\n"
+              << "  --output FILE    where to write results (default: overwrite input)\n"
+              << "  --seed N         history generator seed\n"
+              << "  --threads N      worker threads (default: hardware concurrency)\n"
+              << "  --strict         fail if the input contains invalid records\n"
+              << "  --advance-semester\n"
+              << "                   move every student to the next semester and archive\n"
+              << "                   graduates instead of only recalculating scholarships\n"
+              << "  --archive FILE   where graduates go (default: input with .archive)\n";
+}
+
+template <typename T>
+T parseNumber(std::string_view option, std::string_view text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size()) {
+        throw std::invalid_argument(std::string("Invalid value for ") + std::string(option) +
+                                    ": " + std::string(text));
+    }
+    return value;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage(argv[0]);
+            std::exit(0);
+        }
+        if (option == "--strict") {
+            options.strict = true;
+            continue;
+        }
+        if (option == "--advance-semester") {
+            options.advanceSemester = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument(std::string("Missing value for ") + std::string(option));
+        }
+        std::string_view value = argv[++i];
+        if (option == "--input") {
+            options.input = value;
+        } else if (option == "--output") {
+            options.output = value;
+        } else if (option == "--archive") {
+            options.archive = value;
+        } else if (option == "--seed") {
+            options.seed = parseNumber<std::uint64_t>(option, value);
+        } else if (option == "--threads") {
+            options.threads = std::max(1u, parseNumber<unsigned>(option, value));
+        } else {
+            throw std::invalid_argument(std::string("Unknown option: ") + std::string(option));
+        }
+    }
+    if (options.output.empty()) {
+        options.output = options.input;
+    }
+    if (options.archive.empty()) {
+        options.archive = StudentArchive::filenameFor(options.input);
+    }
+    return options;
+}
+
+void printStatistics(const std::vector<std::shared_ptr<Student>>& students) {
+    SemesterStatisticsCalculator calculator;
+    auto general = SemesterStatisticsCalculator::summarize(students);
+    std::cout << std::format("Total Students: {}\n", general.total)
+              << std::format("Budget Students: {}\n", general.budget)
+              << std::format("Paid Students: {}\n", general.paid)
+              << std::format("Total Scholarships: {:.2f} BYN\n\n", general.totalScholarship);
+
+    std::cout << std::format("{:<16} {:>10} {:>16}\n", "Semester", "Students", "Scholarships");
+    for (const auto& [year, stats] : calculator.calculate(students)) {
+        std::cout << std::format("{:<16} {:>10} {:>16.2f}\n", std::format("{} (Winter)", year),
+                                 stats.winterCount, stats.winterTotal)
+                  << std::format("{:<16} {:>10} {:>16.2f}\n", std::format("{} (Summer)", year),
+                                 stats.summerCount, stats.summerTotal);
+    }
+}
+
+bool saveAtomically(const StudentDatabase& database, const std::string& output) {
+    const std::string temporary = output + ".tmp";
+    try {
+        database.saveToFile(temporary);
+        std::filesystem::rename(temporary, output);
+        return true;
+    } catch (const std::exception& e) {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        std::cerr << e.what() << "\n";
+        return false;
+    }
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    TaskScheduler::setInstanceWorkerCount(options.threads);
+    const auto start = std::chrono::steady_clock::now();
+    StudentDatabase database;
+    const LoadReport report = database.loadFromFile(options.input);
+    if (!report.clean()) {
+        std::cerr << std::format("{}: skipped {} invalid records\n", options.input,
+                                 report.diagnostics.size());
+        for (const auto& diagnostic : report.diagnostics) {
+            std::cerr << "  " << diagnostic.toString() << "\n";
+        }
+        if (options.strict) {
+            return 1;
+        }
+    }
+    if (report.accepted == 0) {
+        std::cerr << "No students loaded from " << options.input << "\n";
+        return 1;
+    }
+
+    HistoryGradeGenerator historyGenerator(options.seed);
+    SemesterAdvance advance;
+    if (options.advanceSemester) {
+        advance = database.advanceSemester(historyGenerator);
+    } else {
+        database.updateAllStudents([&historyGenerator](Student& student) {
+            historyGenerator.materializeHistory(student);
+            student.recalculateScholarship();
+        });
+    }
+
+    if (!saveAtomically(database, options.output)) {
+        return 1;
+    }
+
+    if (options.advanceSemester && !advance.graduated.empty()) {
+        try {
+            StudentArchive(options.archive).append(advance.graduated);
+        } catch (const FileIOException& e) {
+            std::cerr << e.what() << "\nKeeping " << advance.graduated.size()
+                      << " graduates in " << options.output << "\n";
+            database.addStudents(advance.graduated);
+            saveAtomically(database, options.output);
+            return 1;
+        }
+    }
+
+    auto students = database.getAllStudents();
+    printStatistics(students);
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "\nProcessed " << students.size() << " students from " << options.input
+              << " into " << options.output << " in " << elapsed.count() << " s\n";
+    if (options.advanceSemester) {
+        std::cout << "Advanced " << advance.advanced << " students, " << advance.graduated.size()
+                  << " graduated into " << options.archive << "\n";
+    }
+    return 0;
+}
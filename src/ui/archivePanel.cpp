@@ -0,0 +1,149 @@
+#include "ui/archivePanel.h"
+
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QMessageBox>
+#include <QTableView>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <utility>
+
+#include "diagnostics/traceRecorder.h"
+#include "managers/studentTableModel.h"
+#include "services/taskScheduler.h"
+
+ArchivePanel::ArchivePanel(StudentArchive& archive, QWidget* parent)
+    : QWidget(parent), archive(archive) {
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(15, 15, 15, 15);
+    layout->setSpacing(10);
+
+    auto headerLayout = new QHBoxLayout();
+    summaryLabel = new QLabel("Archive is not loaded yet", this);
+    summaryLabel->setStyleSheet("font-weight: bold; font-size: 13px; color: #14a085;");
+    filterEdit = new QLineEdit(this);
+    filterEdit->setPlaceholderText("Filter by name or surname...");
+    filterEdit->setMinimumWidth(300);
+    filterEdit->setStyleSheet(
+        "QLineEdit { background-color: #1e1e1e; color: #EAEAEA; border: 2px solid #0d7377; "
+        "border-radius: 5px; padding: 6px; }");
+    headerLayout->addWidget(summaryLabel);
+    headerLayout->addStretch();
+    headerLayout->addWidget(filterEdit);
+    layout->addLayout(headerLayout);
+
+    yearTable = new QTableWidget(this);
+    yearTable->setColumnCount(5);
+    yearTable->setHorizontalHeaderLabels(QStringList() << "Archived In" << "Students" << "Budget"
+                                                       << "Paid" << "Scholarships Paid (BYN)");
+    yearTable->verticalHeader()->setVisible(false);
+    yearTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    yearTable->horizontalHeader()->setStretchLastSection(true);
+    yearTable->setMaximumHeight(160);
+    layout->addWidget(yearTable);
+
+    model = new StudentTableModel(this);
+    studentTable = new QTableView(this);
+    studentTable->setModel(model);
+    studentTable->verticalHeader()->setVisible(false);
+    studentTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    studentTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    studentTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    studentTable->setAlternatingRowColors(true);
+    studentTable->setToolTip("Double-click a student to view their history");
+    for (auto table : {static_cast<QAbstractItemView*>(yearTable),
+                       static_cast<QAbstractItemView*>(studentTable)}) {
+        table->setStyleSheet(
+            "QAbstractItemView { gridline-color: #2d2d2d; background-color: #1B1B1B; "
+            "alternate-background-color: #1E1E1E; border: 2px solid #0d7377; "
+            "border-radius: 8px; color: #EAEAEA; }"
+            "QHeaderView::section { background-color: #2A2A2A; color: #EAEAEA; padding: 8px; "
+            "border: none; border-bottom: 2px solid #0d7377; }");
+    }
+    layout->addWidget(studentTable, 1);
+
+    connect(filterEdit, &QLineEdit::textChanged, this, &ArchivePanel::applyFilter);
+    connect(studentTable, &QTableView::doubleClicked, this, [this](const QModelIndex& index) {
+        if (auto student = model->studentAt(index.row())) {
+            emit historyRequested(student);
+        }
+    });
+}
+
+void ArchivePanel::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    if (!loadRequested) {
+        loadRequested = true;
+        startLoading();
+    }
+}
+
+void ArchivePanel::refresh() {
+    if (loadRequested && archive.isLoaded()) {
+        startLoading();
+    }
+}
+
+void ArchivePanel::startLoading() {
+    summaryLabel->setText("Loading archive...");
+    auto& scheduler = TaskScheduler::instance();
+    scheduler.submit([this, &scheduler]() {
+        TRACE_SCOPE("ArchivePanel::loadWorker", "database");
+        QString error;
+        if (const LoadReport report = archive.load(); !report.clean()) {
+            error = QString("%1: skipped %2 malformed archive records\n%3")
+                        .arg(QString::fromStdString(archive.getFilename()))
+                        .arg(report.diagnostics.size())
+                        .arg(QString::fromStdString(report.describe()));
+        }
+        auto loaded = archive.records();
+        auto years = archive.summarizeByYear();
+        scheduler.postToMainThread(
+            [this, loaded = std::move(loaded), years = std::move(years), error]() mutable {
+                applyRecords(std::move(loaded), years, error);
+            });
+    });
+}
+
+void ArchivePanel::applyRecords(std::vector<ArchivedStudent> loaded,
+                                const std::map<int, StudentArchive::YearSummary>& years,
+                                const QString& error) {
+    TRACE_SCOPE("ArchivePanel::applyRecords", "ui");
+    records = std::move(loaded);
+    summaryLabel->setText(QString("%1 archived students").arg(records.size()));
+
+    yearTable->setRowCount(static_cast<int>(years.size()));
+    int row = 0;
+    for (const auto& [year, summary] : years) {
+        const QStringList cells{QString::number(year), QString::number(summary.students),
+                                QString::number(summary.budget), QString::number(summary.paid),
+                                QString::number(summary.totalScholarships, 'f', 2)};
+        for (int column = 0; column < cells.size(); ++column) {
+            yearTable->setItem(row, column, new QTableWidgetItem(cells[column]));
+        }
+        ++row;
+    }
+
+    applyFilter();
+    studentTable->setColumnHidden(model->sectionOf(StudentTableModel::Column::Actions), true);
+
+    if (!error.isEmpty()) {
+        QMessageBox::warning(this, "Archive", error);
+    }
+}
+
+void ArchivePanel::applyFilter() {
+    const QString filter = filterEdit->text().trimmed();
+    std::vector<std::shared_ptr<Student>> students;
+    students.reserve(records.size());
+    for (const auto& [student, archivedOn] : records) {
+        if (filter.isEmpty() ||
+            QString::fromStdString(student->getName()).contains(filter, Qt::CaseInsensitive) ||
+            QString::fromStdString(student->getSurname()).contains(filter, Qt::CaseInsensitive)) {
+            students.push_back(student);
+        }
+    }
+    model->setStudents(students, true);
+}
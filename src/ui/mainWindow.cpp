@@ -8,43 +8,42 @@
 #include <random>
 #include <set>
 #include <sstream>
+#include <utility>
 #include <vector>
 
+#include "diagnostics/metricsRegistry.h"
+#include "diagnostics/traceRecorder.h"
 #include "exceptions/exceptions.h"
+#include "services/taskScheduler.h"
 #include "ui/studentDialogBuilder.h"
 
+namespace {
+constexpr std::size_t kLoadBatchSize = 256;
+}
+
 MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     setupUI();
     historyDialog = std::make_unique<StudentHistoryDialog>(this);
 
     database.setFilename("students.txt");
-
-    try {
-        database.loadFromFile();
-        fillMissingHistoryGrades();
-    } catch (const FileIOException& e) {
-        QMessageBox::warning(
-            this, "File Error",
-            QString("Could not load file: %1\nStarting with empty database.").arg(e.what()));
-    } catch (const ParseException& e) {
-        QMessageBox::warning(this, "Validation Error",
-                             QString("Some students were skipped due to invalid "
-                                     "data:\n\n%1\n\nPlease check the file and fix the errors.")
-                                 .arg(e.what()));
-    }
+    archive.setFilename(StudentArchive::filenameFor(database.getFilename()));
+    database.changes().subscribe(
+        [this](const StudentChangeFeed::Batch& changes) { onStudentsChanged(changes); });
 
     showAllStudents();
-    updateStatistics();
+    QTimer::singleShot(0, this, &MainWindow::startLoading);
 }
 
-MainWindow::~MainWindow() = default;
-
-bool MainWindow::eventFilter(QObject* obj, QEvent* event) {
-    if (obj == studentTable->horizontalHeader() && event->type() == QEvent::MouseButtonPress) {
-        return true;
+MainWindow::~MainWindow() {
+    loadStop.request_stop();
+    searchStop.request_stop();
+    try {
+        TaskScheduler::instance().waitForIdle();
+    } catch (const std::exception& e) {
+        qWarning("Background task failed: %s", e.what());
+    } catch (...) {
+        qWarning("Background task failed with an unknown exception");
     }
-
-    return QMainWindow::eventFilter(obj, event);
 }
 
 void MainWindow::setupUI() {
@@ -72,9 +71,56 @@ void MainWindow::setupUI() {
     createTabs();
     mainLayout->addWidget(tabWidget, 1);
 
+    auto traceShortcut = new QShortcut(QKeySequence("Ctrl+Shift+T"), this);
+    connect(traceShortcut, &QShortcut::activated, this, &MainWindow::toggleTracing);
+
+    auto metricsShortcut = new QShortcut(QKeySequence("Ctrl+Shift+D"), this);
+    connect(metricsShortcut, &QShortcut::activated, this, &MainWindow::toggleMetricsPanel);
+
     updateStatistics();
 }
 
+void MainWindow::toggleMetricsPanel() {
+    if (!metricsPanel) {
+        metricsPanel = new MetricsPanel(this);
+        metricsPanel->setMemoryReportProvider([this](MemoryFootprint::Mode mode) {
+            if (loading) {
+                return QString("Memory cannot be measured while the database is loading.\n");
+            }
+            MemoryFootprint footprint = database.memoryFootprint(mode);
+            footprint.merge(searchIndex.memoryFootprint());
+            footprint.merge(tableManager->memoryFootprint(mode));
+            return QString::fromStdString(footprint.toText());
+        });
+    }
+
+    int index = tabWidget->indexOf(metricsPanel);
+    if (index >= 0) {
+        tabWidget->removeTab(index);
+        metricsPanel->hide();
+    } else {
+        tabWidget->setCurrentIndex(tabWidget->addTab(metricsPanel, "Debug"));
+    }
+}
+
+void MainWindow::toggleTracing() {
+    auto& recorder = TraceRecorder::instance();
+    if (!TraceRecorder::isEnabled()) {
+        recorder.clear();
+        recorder.setEnabled(true);
+        statusBar()->showMessage("Tracing started, press Ctrl+Shift+T again to save the trace");
+        return;
+    }
+
+    recorder.setEnabled(false);
+    const QString path = QDir::current().absoluteFilePath("scholar-trace.json");
+    if (recorder.writeChromeTrace(path.toStdString())) {
+        statusBar()->showMessage(QString("Trace saved to %1").arg(path), 5000);
+    } else {
+        QMessageBox::warning(this, "File Error", QString("Could not write %1").arg(path));
+    }
+}
+
 void MainWindow::createTabs() {
     tabWidget = new QTabWidget(this);
     auto studentsTab = new QWidget(this);
@@ -85,6 +131,19 @@ void MainWindow::createTabs() {
 
     tabWidget->addTab(studentsTab, "Students");
     tabWidget->addTab(statisticsTab, "Statistics");
+
+    archivePanel = new ArchivePanel(archive, this);
+    connect(archivePanel, &ArchivePanel::historyRequested, this,
+            [this](const std::shared_ptr<Student>& student) {
+                historyDialog->showHistory(student);
+            });
+    tabWidget->addTab(archivePanel, "Archive");
+
+    connect(tabWidget, &QTabWidget::currentChanged, this, [this, statisticsTab](int index) {
+        if (semesterStatsDirty && tabWidget->widget(index) == statisticsTab) {
+            refreshSemesterTable();
+        }
+    });
 }
 
 void MainWindow::createStudentsTab(QWidget* tab) {
@@ -129,12 +188,23 @@ void MainWindow::createStudentsTab(QWidget* tab) {
         "}"
         "QPushButton:hover { background-color: #14a085; }"
         "QPushButton:pressed { background-color: #0a5d61; }");
+    searchDebounce = new QTimer(this);
+    searchDebounce->setSingleShot(true);
+    searchDebounce->setInterval(150);
+    connect(searchDebounce, &QTimer::timeout, this, &MainWindow::searchStudent);
+
     connect(searchButton, &QPushButton::clicked, this, &MainWindow::searchStudent);
     connect(searchEdit, &QLineEdit::returnPressed, this, &MainWindow::searchStudent);
+    connect(searchEdit, &QLineEdit::textEdited, this, &MainWindow::scheduleSearch);
+
+    searchStatusLabel = new QLabel(this);
+    searchStatusLabel->setStyleSheet("font-size: 12px; color: #888888;");
+    searchStatusLabel->setVisible(false);
 
     searchLayout->addWidget(searchLabel);
     searchLayout->addWidget(searchEdit);
     searchLayout->addWidget(searchButton);
+    searchLayout->addWidget(searchStatusLabel);
     searchLayout->addStretch();
 
     mainLayout->addLayout(searchLayout);
@@ -194,11 +264,28 @@ void MainWindow::createStudentsTab(QWidget* tab) {
     connect(addStudentButton, &QPushButton::clicked, this, &MainWindow::addStudent);
     buttonsLayout->addWidget(addStudentButton);
 
+    bulkEditButton = new QPushButton("Edit Selected", this);
+    bulkEditButton->setStyleSheet(buttonStyle);
+    bulkEditButton->setToolTip("Ctrl+click or Shift+click rows to select several students");
+    connect(bulkEditButton, &QPushButton::clicked, this, &MainWindow::bulkEditSelectedStudents);
+    buttonsLayout->addWidget(bulkEditButton);
+
+    archiveButton = new QPushButton("Archive Selected", this);
+    archiveButton->setStyleSheet(buttonStyle);
+    archiveButton->setToolTip("Move the selected students out of the active list into the archive");
+    connect(archiveButton, &QPushButton::clicked, this, &MainWindow::archiveSelectedStudents);
+    buttonsLayout->addWidget(archiveButton);
+
     calculateButton = new QPushButton("Calculate Scholarships", this);
     calculateButton->setStyleSheet(buttonStyle);
     connect(calculateButton, &QPushButton::clicked, this, &MainWindow::calculateAllScholarships);
     buttonsLayout->addWidget(calculateButton);
 
+    advanceSemesterButton = new QPushButton("Advance Semester", this);
+    advanceSemesterButton->setStyleSheet(buttonStyle);
+    connect(advanceSemesterButton, &QPushButton::clicked, this, &MainWindow::advanceSemester);
+    buttonsLayout->addWidget(advanceSemesterButton);
+
     QFont tableFont = addStudentButton->font();
     tableFont.setBold(false);
     studentTable->setFont(tableFont);
@@ -329,34 +416,35 @@ void MainWindow::createStatisticsTab(QWidget* tab) {
 }
 
 void MainWindow::createStudentTable() {
-    studentTable = new QTableWidget(this);
+    studentTable = new QTableView(this);
     tableManager = std::make_unique<StudentTableManager>(studentTable, this);
-    tableManager->configure(this);
+    tableManager->configure();
     // Connect action button signals from table manager to slots
     connect(tableManager.get(), &StudentTableManager::editStudentRequested, this, [this](int row) {
-        if (row >= 0 && row < static_cast<int>(currentView.size())) {
-            studentTable->setCurrentCell(row, 0);
+        if (row >= 0 && row < tableManager->rowCount()) {
+            studentTable->setCurrentIndex(studentTable->model()->index(row, 0));
             editSelectedStudent();
         }
     });
 
     connect(tableManager.get(), &StudentTableManager::deleteStudentRequested, this,
             [this](int row) {
-                if (row >= 0 && row < static_cast<int>(currentView.size())) {
-                    studentTable->setCurrentCell(row, 0);
+                if (row >= 0 && row < tableManager->rowCount()) {
+                    studentTable->setCurrentIndex(studentTable->model()->index(row, 0));
                     deleteSelectedStudent();
                 }
             });
 
     connect(tableManager.get(), &StudentTableManager::viewHistoryRequested, this, [this](int row) {
-        if (row >= 0 && row < static_cast<int>(currentView.size())) {
-            studentTable->setCurrentCell(row, 0);
+        if (row >= 0 && row < tableManager->rowCount()) {
+            studentTable->setCurrentIndex(studentTable->model()->index(row, 0));
             showStudentHistory();
         }
     });
 }
 
 void MainWindow::addStudent() {
+    TRACE_SCOPE("MainWindow::addStudent", "ui");
     StudentDialogBuilder builder(this);
     StudentDialogResult result = builder.showAddDialog();
 
@@ -365,6 +453,7 @@ void MainWindow::addStudent() {
     }
 
     try {
+        ScopedLatency latency("add");
         int semester = result.getSemester();
         int course = (semester - 1) / 2 + 1;
 
@@ -377,18 +466,12 @@ void MainWindow::addStudent() {
 
         historyGradeGenerator.ensureHistoryForNewStudent(*student, semester);
 
-        database.addStudent(student);
-
-        if (scholarshipsCalculated) {
-            scholarshipsNeedRecalculation = true;
-            recalculationWarning->setVisible(true);
-        }
-
-        showAllStudents();
-        updateStatistics();
-
+        StudentTransaction transaction;
+        transaction.add(student);
+        database.commit(transaction);
         saveDatabaseToFile();
 
+        latency.stop();
         QMessageBox::information(this, "Success", "Student added successfully!");
     } catch (const ValidationException& e) {
         QMessageBox::critical(this, "Validation Error", e.what());
@@ -399,84 +482,182 @@ void MainWindow::addStudent() {
     }
 }
 
-void MainWindow::searchStudent() {
-    QString searchText = searchEdit->text().trimmed();
+void MainWindow::scheduleSearch() { searchDebounce->start(); }
 
-    if (searchText.isEmpty()) {
+void MainWindow::searchStudent() {
+    TRACE_SCOPE("MainWindow::searchStudent", "ui");
+    searchStarted = std::chrono::steady_clock::now();
+    searchDebounce->stop();
+    searchStop.request_stop();
+    searchStop = std::stop_source();
+    const quint64 generation = ++searchGeneration;
+
+    const QString query = StudentSearchIndex::fold(searchEdit->text().trimmed());
+    if (query.isEmpty()) {
+        lastSearchQuery.clear();
+        lastSearchMatches.clear();
+        searchStatusLabel->setVisible(false);
         showAllStudents();
         return;
     }
 
-    try {
-        std::vector<std::shared_ptr<Student>> results =
-            database.searchByName(searchText.toStdString());
+    std::optional<std::vector<int>> candidates;
+    if (!lastSearchQuery.isEmpty() && query.contains(lastSearchQuery) &&
+        lastSearchVersion == searchIndex.version()) {
+        candidates = lastSearchMatches;
+    }
 
-        if (results.empty()) {
-            throw StudentNotFoundException(searchText.toStdString());
-        }
+    auto snapshot = searchIndex.snapshot();
+    auto indexVersion = searchIndex.version();
+    auto stopToken = searchStop.get_token();
+    auto& scheduler = TaskScheduler::instance();
+    scheduler.submit(
+        [this, &scheduler, generation, query, indexVersion, snapshot, stopToken,
+         candidates = std::move(candidates)]() {
+            auto matches = StudentSearchIndex::search(*snapshot, query,
+                                                      candidates ? &*candidates : nullptr,
+                                                      stopToken);
+            if (!matches) return;
+            scheduler.postToMainThread([this, generation, query, indexVersion, snapshot,
+                                        matches = std::move(*matches)]() mutable {
+                applySearchResults(generation, query, indexVersion, snapshot,
+                                   std::move(matches));
+            });
+        },
+        TaskPriority::Interactive, stopToken);
+}
 
-        updateStudentTable(results);
-    } catch (const StudentNotFoundException& e) {
-        QMessageBox::information(this, "Not Found", e.what());
-        showAllStudents();
-    } catch (const DatabaseException& e) {
-        QMessageBox::critical(this, "Search Error", e.what());
+void MainWindow::applySearchResults(quint64 generation, const QString& query,
+                                    std::uint64_t indexVersion,
+                                    const StudentSearchIndex::Snapshot& snapshot,
+                                    std::vector<int> matches) {
+    TRACE_SCOPE("MainWindow::applySearchResults", "ui");
+    if (generation != searchGeneration) {
+        return;
+    }
+    recordLatency("search", searchStarted);
+
+    std::vector<std::shared_ptr<Student>> results;
+    results.reserve(matches.size());
+    for (int index : matches) {
+        results.push_back((*snapshot)[index].student);
+    }
+
+    lastSearchQuery = query;
+    lastSearchVersion = indexVersion;
+    lastSearchMatches = std::move(matches);
+
+    updateStudentTable(results);
+
+    if (results.empty()) {
+        searchStatusLabel->setText(
+            QString("No students match \"%1\"").arg(searchEdit->text().trimmed()));
+        searchStatusLabel->setStyleSheet("font-size: 12px; color: #ff6464;");
+    } else {
+        searchStatusLabel->setText(
+            QString("Found %1 of %2").arg(results.size()).arg(snapshot->size()));
+        searchStatusLabel->setStyleSheet("font-size: 12px; color: #888888;");
     }
+    searchStatusLabel->setVisible(true);
 }
 
 void MainWindow::calculateAllScholarships() {
-    auto allStudents = database.getAllStudents();
-    int count = 0;
+    TRACE_SCOPE("MainWindow::calculateAllScholarships", "ui");
+    ScopedLatency latency("recalculate");
+    int count = static_cast<int>(database.getStudentCount());
 
-    for (const auto& student : allStudents) {
-        student->recalculateScholarship();
-        count++;
-    }
+    database.updateAllStudents([this](Student& student) {
+        historyGradeGenerator.materializeHistory(student);
+        student.recalculateScholarship();
+    });
 
     scholarshipsCalculated = true;
     scholarshipsNeedRecalculation = false;
     recalculationWarning->setVisible(false);
 
-    database.saveToFile();
+    saveDatabaseToFile();
     showAllStudents();
-    updateStatistics();
 
+    latency.stop();
     QMessageBox::information(
         this, "Success",
         QString("Successfully calculated scholarships for %1 students.").arg(count));
 }
 
+void MainWindow::advanceSemester() {
+    TRACE_SCOPE("MainWindow::advanceSemester", "ui");
+    int ret = QMessageBox::question(
+        this, "Confirm",
+        QString("Move all %1 students to the next semester?\nStudents who finished semester %2 "
+                "graduate and move to the archive.")
+            .arg(database.getStudentCount())
+            .arg(StudentDatabase::kFinalSemester),
+        QMessageBox::Yes | QMessageBox::No);
+    if (ret != QMessageBox::Yes) {
+        return;
+    }
+
+    ScopedLatency latency("advance-semester");
+    SemesterAdvance result = database.advanceSemester(historyGradeGenerator);
+    pendingGraduates.insert(pendingGraduates.end(), result.graduated.begin(),
+                            result.graduated.end());
+
+    database.changes().flush();
+    scholarshipsCalculated = true;
+    scholarshipsNeedRecalculation = false;
+    recalculationWarning->setVisible(false);
+
+    saveDatabaseToFile();
+    showAllStudents();
+
+    latency.stop();
+    QMessageBox::information(this, "Success",
+                             QString("%1 students moved to the next semester, %2 graduated.")
+                                 .arg(result.advanced)
+                                 .arg(result.graduated.size()));
+}
+
 void MainWindow::showAllStudents() {
+    TRACE_SCOPE("MainWindow::showAllStudents", "ui");
     std::vector<std::shared_ptr<Student>> allStudents = database.getAllStudents();
     updateStudentTable(allStudents);
 }
 
 void MainWindow::updateStudentTable(const std::vector<std::shared_ptr<Student>>& studentList) {
-    currentView = studentList;
     if (tableManager) {
         tableManager->populate(studentList, scholarshipsCalculated);
     }
 }
 
 void MainWindow::updateStatistics() {
+    TRACE_SCOPE("MainWindow::updateStatistics", "ui");
+    ScopedLatency latency("statistics");
     auto allStudents = database.getAllStudents();
+    MetricsRegistry::instance().setGauge("database.students",
+                                         static_cast<double>(allStudents.size()));
     statisticsUpdater.updateGeneralStatistics(allStudents, totalStudentsLabel, budgetStudentsLabel,
                                               paidStudentsLabel, totalScholarshipLabel);
-    if (semesterStatsTable) {
-        statisticsUpdater.updateSemesterTable(allStudents, semesterStatsTable);
+    semesterStatsDirty = true;
+    if (semesterStatsTable && semesterStatsTable->isVisible()) {
+        refreshSemesterTable();
     }
 }
 
+void MainWindow::refreshSemesterTable() {
+    database.materializeHistory(historyGradeGenerator);
+    statisticsUpdater.updateSemesterTable(database.snapshot().toVector(), semesterStatsTable);
+    semesterStatsDirty = false;
+}
+
 void MainWindow::editSelectedStudent() {
-    int row = studentTable->currentRow();
-    if (row < 0 || row >= static_cast<int>(currentView.size())) {
+    TRACE_SCOPE("MainWindow::editSelectedStudent", "ui");
+    int row = studentTable->currentIndex().row();
+    auto student = tableManager->studentAt(row);
+    if (!student) {
         QMessageBox::warning(this, "Error", "Please select a student to edit.");
         return;
     }
 
-    auto student = currentView[row];
-    if (!student) return;
-
     StudentDialogBuilder builder(this);
     StudentDialogResult result = builder.showEditDialog(student);
 
@@ -485,46 +666,134 @@ void MainWindow::editSelectedStudent() {
     }
 
     try {
-        int oldSemester = student->getSemester();
-        double oldGrade = student->getAverageGrade();
-        int newSemester = result.getSemester();
-
-        student->setName(result.getName().toStdString());
-        student->setSurname(result.getSurname().toStdString());
-        student->setSemester(newSemester);
-        student->setAverageGrade(result.getAverageGrade());
-        student->setIsBudget(result.isBudget());
-        student->setMissedHours(result.getMissedHours());
-        student->setHasSocialScholarship(result.hasSocialScholarship());
+        ScopedLatency latency("edit");
+        StudentTransaction transaction;
+        transaction.update(student, [this, &result](Student& edited) {
+            int oldSemester = edited.getSemester();
+            double oldGrade = edited.getAverageGrade();
+            int newSemester = result.getSemester();
+
+            edited.setName(result.getName().toStdString());
+            edited.setSurname(result.getSurname().toStdString());
+            edited.setSemester(newSemester);
+            edited.setAverageGrade(result.getAverageGrade());
+            edited.setIsBudget(result.isBudget());
+            edited.setMissedHours(result.getMissedHours());
+            edited.setHasSocialScholarship(result.hasSocialScholarship());
+
+            historyGradeGenerator.handleSemesterChange(edited, oldSemester, oldGrade,
+                                                       newSemester);
+        });
+        database.commit(transaction);
+        saveDatabaseToFile();
 
-        historyGradeGenerator.handleSemesterChange(*student, oldSemester, oldGrade, newSemester);
+        latency.stop();
+        QMessageBox::information(this, "Success", "Student data updated.");
+    } catch (const TransactionRejectedException& e) {
+        QMessageBox::critical(this, "Validation Error", e.what());
+    } catch (const ScholarshipException& e) {
+        QMessageBox::critical(this, "Error", e.what());
+    }
+}
 
-        if (scholarshipsCalculated) {
-            scholarshipsNeedRecalculation = true;
-            recalculationWarning->setVisible(true);
-        }
+void MainWindow::bulkEditSelectedStudents() {
+    TRACE_SCOPE("MainWindow::bulkEditSelectedStudents", "ui");
+    auto selected = tableManager->selectedStudents();
+    if (selected.empty()) {
+        QMessageBox::warning(this, "Error", "Please select the students to edit.");
+        return;
+    }
 
-        showAllStudents();
-        updateStatistics();
+    StudentDialogBuilder builder(this);
+    StudentBulkEditResult result = builder.showBulkEditDialog(selected.size());
+    if (!result.isAccepted() || !result.hasChanges()) {
+        return;
+    }
+
+    try {
+        ScopedLatency latency("bulk-edit");
+        const bool recalculate = scholarshipsCalculated;
+        StudentTransaction transaction;
+        for (const auto& student : selected) {
+            transaction.update(student, [this, &result, recalculate](Student& edited) {
+                int oldSemester = edited.getSemester();
+                double oldGrade = edited.getAverageGrade();
+                int newSemester = result.semesterFor(oldSemester);
+
+                if (auto budget = result.isBudget()) edited.setIsBudget(*budget);
+                if (auto hours = result.getMissedHours()) edited.setMissedHours(*hours);
+                if (auto social = result.hasSocialScholarship()) {
+                    edited.setHasSocialScholarship(*social);
+                }
+                edited.setSemester(newSemester);
 
+                historyGradeGenerator.handleSemesterChange(edited, oldSemester, oldGrade,
+                                                           newSemester);
+                if (recalculate) {
+                    historyGradeGenerator.materializeHistory(edited);
+                    edited.recalculateScholarship();
+                }
+            });
+        }
+
+        const bool wasStale = scholarshipsNeedRecalculation;
+        database.commit(transaction);
+        if (recalculate) {
+            database.changes().flush();
+            scholarshipsNeedRecalculation = wasStale;
+            recalculationWarning->setVisible(wasStale);
+        }
         saveDatabaseToFile();
 
-        QMessageBox::information(this, "Success", "Student data updated.");
-    } catch (const ValidationException& e) {
+        latency.stop();
+        statusBar()->showMessage(QString("Updated %1 students").arg(selected.size()), 3000);
+    } catch (const TransactionRejectedException& e) {
         QMessageBox::critical(this, "Validation Error", e.what());
     } catch (const ScholarshipException& e) {
         QMessageBox::critical(this, "Error", e.what());
     }
 }
 
+void MainWindow::archiveSelectedStudents() {
+    TRACE_SCOPE("MainWindow::archiveSelectedStudents", "ui");
+    auto selected = tableManager->selectedStudents();
+    if (selected.empty()) {
+        QMessageBox::warning(this, "Error", "Please select the students to archive.");
+        return;
+    }
+    int ret = QMessageBox::question(
+        this, "Confirm",
+        QString("Move %1 students to the archive? They will no longer appear in the student "
+                "list, search or statistics.")
+            .arg(selected.size()),
+        QMessageBox::Yes | QMessageBox::No);
+    if (ret != QMessageBox::Yes) {
+        return;
+    }
+
+    try {
+        ScopedLatency latency("archive");
+        archive.moveFrom(database, selected, historyGradeGenerator);
+        saveDatabaseToFile();
+        archivePanel->refresh();
+
+        latency.stop();
+        statusBar()->showMessage(QString("Archived %1 students").arg(selected.size()), 3000);
+    } catch (const TransactionRejectedException& e) {
+        QMessageBox::critical(this, "Database Error", e.what());
+    } catch (const FileIOException& e) {
+        QMessageBox::critical(this, "File Error", e.what());
+    }
+}
+
 void MainWindow::deleteSelectedStudent() {
-    int row = studentTable->currentRow();
-    if (row < 0 || row >= static_cast<int>(currentView.size())) {
+    TRACE_SCOPE("MainWindow::deleteSelectedStudent", "ui");
+    int row = studentTable->currentIndex().row();
+    auto student = tableManager->studentAt(row);
+    if (!student) {
         QMessageBox::warning(this, "Error", "Please select a student to delete.");
         return;
     }
-    auto student = currentView[row];
-    if (!student) return;
     int ret = QMessageBox::question(this, "Confirm",
                                     QString("Are you sure you want to delete student %1 %2?")
                                         .arg(QString::fromStdString(student->getName()))
@@ -532,18 +801,13 @@ void MainWindow::deleteSelectedStudent() {
                                     QMessageBox::Yes | QMessageBox::No);
     if (ret == QMessageBox::Yes) {
         try {
-            database.removeStudentPtr(student);
-
-            if (scholarshipsCalculated) {
-                scholarshipsNeedRecalculation = true;
-                recalculationWarning->setVisible(true);
-            }
-
-            showAllStudents();
-            updateStatistics();
-
+            ScopedLatency latency("delete");
+            StudentTransaction transaction;
+            transaction.remove(student);
+            database.commit(transaction);
             saveDatabaseToFile();
 
+            latency.stop();
             QMessageBox::information(this, "Success", "Student deleted.");
         } catch (const DatabaseException& e) {
             QMessageBox::critical(this, "Database Error", e.what());
@@ -552,14 +816,21 @@ void MainWindow::deleteSelectedStudent() {
 }
 
 void MainWindow::showStudentHistory() {
-    int row = studentTable->currentRow();
-    if (row < 0 || row >= static_cast<int>(currentView.size())) {
+    TRACE_SCOPE("MainWindow::showStudentHistory", "ui");
+    int row = studentTable->currentIndex().row();
+    auto student = tableManager->studentAt(row);
+    if (!student) {
         QMessageBox::warning(this, "Error", "Please select a student to view history.");
         return;
     }
-
-    auto student = currentView[row];
-    if (!student) return;
+    if (!student->isHistoryMaterialized()) {
+        auto materialized = database.updateStudent(student, [this](Student& target) {
+            historyGradeGenerator.materializeHistory(target);
+        });
+        if (materialized) {
+            student = materialized;
+        }
+    }
 
     if (!historyDialog) {
         historyDialog = std::make_unique<StudentHistoryDialog>(this);
@@ -567,14 +838,174 @@ void MainWindow::showStudentHistory() {
     historyDialog->showHistory(student);
 }
 
-void MainWindow::fillMissingHistoryGrades() const {
-    historyGradeGenerator.fillMissingHistoryForAll(database.getAllStudents());
+void MainWindow::startLoading() {
+    loadStarted = std::chrono::steady_clock::now();
+    loading = true;
+    calculateButton->setEnabled(false);
+    advanceSemesterButton->setEnabled(false);
+
+    loadProgress = new QProgressBar(this);
+    loadProgress->setRange(0, 100);
+    loadProgress->setMaximumWidth(240);
+    loadProgress->setTextVisible(true);
+    statusBar()->addPermanentWidget(loadProgress);
+    statusBar()->showMessage("Loading students...");
+
+    const std::string filename = database.getFilename();
+    auto stopToken = loadStop.get_token();
+    auto& scheduler = TaskScheduler::instance();
+    scheduler.submit([this, &scheduler, filename, stopToken]() {
+        TRACE_SCOPE("MainWindow::loadWorker", "database");
+        QString errorTitle;
+        QString error;
+        const LoadReport report = StudentDatabase::streamFromFile(
+            filename, kLoadBatchSize,
+            [this, &scheduler](std::vector<std::shared_ptr<Student>>&& batch,
+                               std::size_t bytesRead, std::size_t totalBytes) {
+                scheduler.postToMainThread(
+                    [this, batch = std::move(batch), bytesRead, totalBytes]() {
+                        appendLoadedStudents(batch, bytesRead, totalBytes);
+                    });
+            },
+            stopToken);
+        if (!report.clean()) {
+            errorTitle = "Validation Error";
+            error = QString("%1 students were skipped due to invalid "
+                            "data:\n\n%2\n\nPlease check the file and fix the errors.")
+                        .arg(report.diagnostics.size())
+                        .arg(QString::fromStdString(report.describe()));
+        }
+        scheduler.postToMainThread(
+            [this, errorTitle, error]() { finishLoading(errorTitle, error); });
+    });
+}
+
+void MainWindow::appendLoadedStudents(const std::vector<std::shared_ptr<Student>>& batch,
+                                      std::size_t bytesRead, std::size_t totalBytes) {
+    TRACE_SCOPE("MainWindow::appendLoadedStudents", "ui");
+    database.addStudents(batch);
+    if (loadProgress && totalBytes > 0) {
+        loadProgress->setValue(static_cast<int>(bytesRead * 100 / totalBytes));
+    }
+}
+
+void MainWindow::finishLoading(const QString& errorTitle, const QString& error) {
+    TRACE_SCOPE("MainWindow::finishLoading", "ui");
+    recordLatency("load", loadStarted);
+    database.changes().flush();
+    loading = false;
+    calculateButton->setEnabled(true);
+    advanceSemesterButton->setEnabled(true);
+
+    statusBar()->removeWidget(loadProgress);
+    loadProgress->deleteLater();
+    loadProgress = nullptr;
+    statusBar()->showMessage(
+        QString("Loaded %1 students").arg(database.getStudentCount()), 3000);
+
+    if (!searchEdit->text().trimmed().isEmpty()) {
+        searchStudent();
+    }
+    QTimer::singleShot(0, this, &MainWindow::runDeferredStartupTasks);
+
+    if (!error.isEmpty()) {
+        QMessageBox::warning(this, errorTitle, error);
+    }
+}
+
+void MainWindow::runDeferredStartupTasks() {
+    TRACE_SCOPE("MainWindow::runDeferredStartupTasks", "ui");
+    updateStatistics();
+    if (saveAfterLoad) {
+        saveAfterLoad = false;
+        saveDatabaseToFile();
+    }
 }
 
 void MainWindow::saveDatabaseToFile() {
-    try {
-        database.saveToFile();
-    } catch (const FileWriteException& e) {
-        QMessageBox::warning(this, "File Error", e.what());
+    TRACE_SCOPE("MainWindow::saveDatabaseToFile", "ui");
+    if (loading) {
+        saveAfterLoad = true;
+        return;
+    }
+    if (saving) {
+        saveAgain = true;
+        return;
+    }
+    saving = true;
+
+    auto& scheduler = TaskScheduler::instance();
+    // Graduates are archived only after the file without them is written; a failed append is
+    // truncated by the archive and the graduates return to the database.
+    scheduler.submit(
+        [this, &scheduler, students = database.snapshot(), filename = database.getFilename(),
+         graduates = std::exchange(pendingGraduates, {})]() {
+            QString error;
+            bool saved = false;
+            try {
+                ScopedLatency latency("save");
+                StudentDatabase::saveSnapshot(students, filename);
+                saved = true;
+                archive.append(graduates);
+            } catch (const std::exception& e) {
+                error = e.what();
+            } catch (...) {
+                error = "Unknown error while saving the database";
+            }
+            scheduler.postToMainThread(
+                [this, error, saved, graduates]() { finishSaving(error, saved, graduates); });
+        },
+        TaskPriority::Background);
+}
+
+void MainWindow::finishSaving(const QString& error, bool saved,
+                              const std::vector<std::shared_ptr<Student>>& graduates) {
+    saving = false;
+    if (saved && !error.isEmpty()) {
+        database.addStudents(graduates);
+        saveAgain = true;
+        QMessageBox::warning(this, "File Error",
+                             QString("Graduated students were kept in the database:\n%1")
+                                 .arg(error));
+    } else if (!error.isEmpty()) {
+        pendingGraduates.insert(pendingGraduates.begin(), graduates.begin(), graduates.end());
+        QMessageBox::warning(this, "File Error", error);
+    } else if (!graduates.empty()) {
+        archivePanel->refresh();
+    }
+    if (std::exchange(saveAgain, false)) {
+        saveDatabaseToFile();
     }
-}
\ No newline at end of file
+}
+
+void MainWindow::onStudentsChanged(const StudentChangeFeed::Batch& changes) {
+    TRACE_SCOPE("MainWindow::onStudentsChanged", "ui");
+    StudentChangeSet summary = StudentChangeFeed::summarize(changes);
+    searchIndex.remove(summary.removed);
+    searchIndex.replace(summary.updated);
+    searchIndex.add(summary.added);
+    if (loading && !searchEdit->text().trimmed().isEmpty()) {
+        summary.added.clear();
+    }
+    tableManager->applyChanges(summary);
+
+    bool scholarshipInputsChanged = false;
+    bool statisticsChanged = false;
+    for (const auto& change : changes) {
+        if (change.kind == StudentChange::Kind::Replaced) continue;
+        const bool fieldChange = change.kind == StudentChange::Kind::FieldChanged;
+        scholarshipInputsChanged = scholarshipInputsChanged || !fieldChange ||
+                                   (change.field != StudentField::Scholarship &&
+                                    change.field != StudentField::History);
+        statisticsChanged =
+            statisticsChanged || !fieldChange || change.field != StudentField::History;
+    }
+
+    if (scholarshipInputsChanged && scholarshipsCalculated) {
+        scholarshipsNeedRecalculation = true;
+        recalculationWarning->setVisible(true);
+    }
+    if (statisticsChanged && !loading) {
+        updateStatistics();
+    }
+}
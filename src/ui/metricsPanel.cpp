@@ -0,0 +1,121 @@
+#include "ui/metricsPanel.h"
+
+#include <QFile>
+#include <QFileDialog>
+#include <QFontDatabase>
+#include <QHBoxLayout>
+#include <QMessageBox>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QScrollBar>
+#include <QTextStream>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include "diagnostics/allocationCounter.h"
+#include "diagnostics/metricsRegistry.h"
+
+MetricsPanel::MetricsPanel(QWidget* parent) : QWidget(parent) {
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(15, 15, 15, 15);
+    layout->setSpacing(10);
+
+    metricsView = new QPlainTextEdit(this);
+    metricsView->setReadOnly(true);
+    metricsView->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    metricsView->setStyleSheet(
+        "QPlainTextEdit { background-color: #1B1B1B; color: #EAEAEA; "
+        "border: 1px solid #3d3d3d; border-radius: 5px; }");
+    layout->addWidget(metricsView, 1);
+
+    auto buttonLayout = new QHBoxLayout();
+    auto resetButton = new QPushButton("Reset", this);
+    auto exportButton = new QPushButton("Export...", this);
+    auto memoryButton = new QPushButton("Measure Memory", this);
+    auto exactMemoryButton = new QPushButton("Measure Memory (Exact)", this);
+    for (auto button : {resetButton, exportButton, memoryButton, exactMemoryButton}) {
+        button->setStyleSheet(
+            "QPushButton { background-color: #0d7377; color: white; padding: 8px 16px; "
+            "border-radius: 5px; font-weight: bold; }"
+            "QPushButton:hover { background-color: #14a085; }");
+    }
+    if (!allocationCountingEnabled()) {
+        exactMemoryButton->setEnabled(false);
+        exactMemoryButton->setToolTip("Build with SCHOLAR_COUNT_ALLOCATIONS=ON to enable");
+    }
+    buttonLayout->addWidget(memoryButton);
+    buttonLayout->addWidget(exactMemoryButton);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(resetButton);
+    buttonLayout->addWidget(exportButton);
+    layout->addLayout(buttonLayout);
+
+    refreshTimer = new QTimer(this);
+    refreshTimer->setInterval(1000);
+
+    connect(refreshTimer, &QTimer::timeout, this, &MetricsPanel::refresh);
+    connect(resetButton, &QPushButton::clicked, this, &MetricsPanel::resetMetrics);
+    connect(exportButton, &QPushButton::clicked, this, &MetricsPanel::exportMetrics);
+    connect(memoryButton, &QPushButton::clicked, this,
+            [this] { measureMemory(MemoryFootprint::Mode::Estimate); });
+    connect(exactMemoryButton, &QPushButton::clicked, this,
+            [this] { measureMemory(MemoryFootprint::Mode::Exact); });
+}
+
+void MetricsPanel::setMemoryReportProvider(MemoryReportProvider provider) {
+    memoryReportProvider = std::move(provider);
+}
+
+QString MetricsPanel::reportText() const {
+    QString text = QString::fromStdString(MetricsRegistry::instance().exportText());
+    if (!memoryReport.isEmpty()) {
+        text += "\n" + memoryReport;
+    }
+    return text;
+}
+
+void MetricsPanel::measureMemory(MemoryFootprint::Mode mode) {
+    if (!memoryReportProvider) {
+        return;
+    }
+    memoryReport = memoryReportProvider(mode);
+    refresh();
+}
+
+void MetricsPanel::refresh() {
+    int scroll = metricsView->verticalScrollBar()->value();
+    metricsView->setPlainText(reportText());
+    metricsView->verticalScrollBar()->setValue(scroll);
+}
+
+void MetricsPanel::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    refresh();
+    refreshTimer->start();
+}
+
+void MetricsPanel::hideEvent(QHideEvent* event) {
+    refreshTimer->stop();
+    QWidget::hideEvent(event);
+}
+
+void MetricsPanel::resetMetrics() {
+    MetricsRegistry::instance().reset();
+    refresh();
+}
+
+void MetricsPanel::exportMetrics() {
+    QString path = QFileDialog::getSaveFileName(this, "Export Metrics", "scholar-metrics.txt",
+                                                "Text files (*.txt)");
+    if (path.isEmpty()) {
+        return;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QMessageBox::warning(this, "File Error", QString("Could not write %1").arg(path));
+        return;
+    }
+    QTextStream stream(&file);
+    stream << reportText();
+}
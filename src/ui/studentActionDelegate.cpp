@@ -0,0 +1,174 @@
+#include "ui/studentActionDelegate.h"
+
+#include <QAbstractItemView>
+#include <QEvent>
+#include <QFont>
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QToolTip>
+#include <algorithm>
+
+StudentActionDelegate::StudentActionDelegate(QAbstractItemView* view)
+    : QStyledItemDelegate(view),
+      view(view),
+      buttons{{
+          {Action::Edit, "✏️", "Edit Student", 10, QColor("#0d7377"), QColor("#14a085"),
+           QColor("#0a5d61")},
+          {Action::ViewHistory, "👁️", "View History", 14, QColor("#0d7377"), QColor("#14a085"),
+           QColor("#0a5d61")},
+          {Action::Delete, "❌", "Delete Student", 14, QColor("#d32f2f"), QColor("#f44336"),
+           QColor("#b71c1c")},
+      }} {
+    if (view && view->viewport()) {
+        view->viewport()->setMouseTracking(true);
+        view->viewport()->installEventFilter(this);
+    }
+}
+
+QRect StudentActionDelegate::buttonRect(const QRect& cell, int button) const {
+    const int count = static_cast<int>(buttons.size());
+    const int totalWidth = count * kButtonSize + (count - 1) * kButtonSpacing;
+    const int left = cell.left() + (cell.width() - totalWidth) / 2;
+    const int top = cell.top() + (cell.height() - kButtonSize) / 2;
+    return {left + button * (kButtonSize + kButtonSpacing), top, kButtonSize, kButtonSize};
+}
+
+std::optional<StudentActionDelegate::Action> StudentActionDelegate::hitTest(
+    const QRect& cell, const QPoint& pos) const {
+    for (int i = 0; i < static_cast<int>(buttons.size()); ++i) {
+        if (buttonRect(cell, i).contains(pos)) {
+            return buttons[i].action;
+        }
+    }
+    return std::nullopt;
+}
+
+const StudentActionDelegate::ButtonStyle* StudentActionDelegate::styleFor(Action action) const {
+    for (const auto& button : buttons) {
+        if (button.action == action) return &button;
+    }
+    return nullptr;
+}
+
+void StudentActionDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option,
+                                  const QModelIndex& index) const {
+    QStyledItemDelegate::paint(painter, option, index);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(Qt::NoPen);
+
+    const bool rowHovered = hoveredIndex.isValid() && hoveredIndex == index;
+    const bool rowPressed = pressedIndex.isValid() && pressedIndex == index;
+
+    for (int i = 0; i < static_cast<int>(buttons.size()); ++i) {
+        const auto& button = buttons[i];
+        QRect rect = buttonRect(option.rect, i);
+
+        QColor background = button.background;
+        if (rowPressed && pressedAction == button.action) {
+            background = button.pressed;
+        } else if (rowHovered && hoveredAction == button.action) {
+            background = button.hover;
+        }
+
+        painter->setBrush(background);
+        painter->drawRoundedRect(rect, 4, 4);
+
+        QFont glyphFont = option.font;
+        glyphFont.setPixelSize(button.fontPixelSize);
+        painter->setFont(glyphFont);
+        painter->setPen(Qt::white);
+        painter->drawText(rect, Qt::AlignCenter, button.glyph);
+        painter->setPen(Qt::NoPen);
+    }
+
+    painter->restore();
+}
+
+QSize StudentActionDelegate::sizeHint(const QStyleOptionViewItem& option,
+                                      const QModelIndex& index) const {
+    QSize size = QStyledItemDelegate::sizeHint(option, index);
+    const int count = static_cast<int>(buttons.size());
+    const int width = count * (kButtonSize + kButtonSpacing) + 2 * kButtonSpacing;
+    return {std::max(size.width(), width), std::max(size.height(), kButtonSize)};
+}
+
+bool StudentActionDelegate::editorEvent(QEvent* event, QAbstractItemModel* model,
+                                        const QStyleOptionViewItem& option,
+                                        const QModelIndex& index) {
+    switch (event->type()) {
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonDblClick: {
+            auto mouseEvent = static_cast<QMouseEvent*>(event);
+            if (mouseEvent->button() != Qt::LeftButton) break;
+            auto action = hitTest(option.rect, mouseEvent->position().toPoint());
+            if (!action) break;
+            pressedIndex = index;
+            pressedAction = action;
+            if (view) view->update(index);
+            return true;
+        }
+        case QEvent::MouseButtonRelease: {
+            auto mouseEvent = static_cast<QMouseEvent*>(event);
+            if (mouseEvent->button() != Qt::LeftButton || !pressedAction) break;
+            auto action = hitTest(option.rect, mouseEvent->position().toPoint());
+            bool sameButton = pressedIndex == index && action == pressedAction;
+            pressedIndex = QPersistentModelIndex();
+            pressedAction.reset();
+            if (view) view->update(index);
+            if (sameButton) {
+                emit actionTriggered(index.row(), *action);
+            }
+            return true;
+        }
+        default:
+            break;
+    }
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
+
+bool StudentActionDelegate::helpEvent(QHelpEvent* event, QAbstractItemView* itemView,
+                                      const QStyleOptionViewItem& option,
+                                      const QModelIndex& index) {
+    if (event->type() == QEvent::ToolTip) {
+        if (auto action = hitTest(option.rect, event->pos())) {
+            QToolTip::showText(event->globalPos(), styleFor(*action)->toolTip, itemView);
+            return true;
+        }
+        QToolTip::hideText();
+        return true;
+    }
+    return QStyledItemDelegate::helpEvent(event, itemView, option, index);
+}
+
+bool StudentActionDelegate::eventFilter(QObject* watched, QEvent* event) {
+    if (!view || watched != view->viewport()) {
+        return QStyledItemDelegate::eventFilter(watched, event);
+    }
+
+    if (event->type() == QEvent::MouseMove) {
+        auto pos = static_cast<QMouseEvent*>(event)->position().toPoint();
+        QModelIndex index = view->indexAt(pos);
+        if (index.isValid() && view->itemDelegateForColumn(index.column()) == this) {
+            setHovered(index, hitTest(view->visualRect(index), pos));
+        } else {
+            setHovered(QModelIndex(), std::nullopt);
+        }
+    } else if (event->type() == QEvent::Leave) {
+        setHovered(QModelIndex(), std::nullopt);
+    }
+    return false;
+}
+
+void StudentActionDelegate::setHovered(const QModelIndex& index, std::optional<Action> action) {
+    if (hoveredIndex == index && hoveredAction == action) {
+        return;
+    }
+    QModelIndex previous = hoveredIndex;
+    hoveredIndex = index;
+    hoveredAction = action;
+    if (previous.isValid()) view->update(previous);
+    if (index.isValid()) view->update(index);
+}
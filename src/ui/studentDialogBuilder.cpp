@@ -10,6 +10,7 @@
 #include <QMessageBox>
 #include <QPushButton>
 #include <QSpinBox>
+#include <algorithm>
 
 #include "entities/student.h"
 
@@ -59,6 +60,47 @@ void StudentDialogResult::setMissedHours(int value) { missedHours = value; }
 bool StudentDialogResult::hasSocialScholarship() const { return socialScholarship; }
 void StudentDialogResult::setHasSocialScholarship(bool value) { socialScholarship = value; }
 
+bool StudentBulkEditResult::isAccepted() const { return accepted; }
+void StudentBulkEditResult::setAccepted(bool value) { accepted = value; }
+
+bool StudentBulkEditResult::hasChanges() const {
+    return semesterChange != SemesterChange::Keep || budget || missedHours || socialScholarship;
+}
+
+StudentBulkEditResult::SemesterChange StudentBulkEditResult::getSemesterChange() const {
+    return semesterChange;
+}
+
+void StudentBulkEditResult::setSemesterChange(SemesterChange change, int value) {
+    semesterChange = change;
+    semester = normalizeSemester(value);
+}
+
+int StudentBulkEditResult::semesterFor(int currentSemester) const {
+    switch (semesterChange) {
+        case SemesterChange::Advance:
+            return normalizeSemester(std::min(currentSemester + 1, 8));
+        case SemesterChange::Set:
+            return semester;
+        case SemesterChange::Keep:
+            break;
+    }
+    return currentSemester;
+}
+
+std::optional<bool> StudentBulkEditResult::isBudget() const { return budget; }
+void StudentBulkEditResult::setIsBudget(std::optional<bool> value) { budget = value; }
+
+std::optional<int> StudentBulkEditResult::getMissedHours() const { return missedHours; }
+void StudentBulkEditResult::setMissedHours(std::optional<int> value) { missedHours = value; }
+
+std::optional<bool> StudentBulkEditResult::hasSocialScholarship() const {
+    return socialScholarship;
+}
+void StudentBulkEditResult::setHasSocialScholarship(std::optional<bool> value) {
+    socialScholarship = value;
+}
+
 StudentDialogBuilder::StudentDialogBuilder(QWidget* parent) : parentWidget(parent) {}
 
 QString StudentDialogBuilder::buildDialogStyle() const {
@@ -249,3 +291,63 @@ StudentDialogResult StudentDialogBuilder::showEditDialog(const std::shared_ptr<S
     }
     return showDialog("Edit Student", "Save", "Name and surname cannot be empty.", student);
 }
+
+StudentBulkEditResult StudentDialogBuilder::showBulkEditDialog(std::size_t studentCount) const {
+    StudentBulkEditResult result;
+    if (studentCount == 0) {
+        return result;
+    }
+
+    QDialog dialog(parentWidget);
+    setupDialog(&dialog, QString("Edit %1 Students").arg(studentCount));
+    auto form = createFormLayout(&dialog);
+
+    auto semesterMode = new QComboBox(&dialog);
+    semesterMode->addItems({"Keep current", "Next semester", "Set to"});
+    auto semesterField = new QSpinBox(&dialog);
+    configureSemesterSpinBox(semesterField);
+    semesterField->setEnabled(false);
+    QObject::connect(semesterMode, QOverload<int>::of(&QComboBox::currentIndexChanged),
+                     semesterField,
+                     [semesterField](int index) { semesterField->setEnabled(index == 2); });
+
+    auto fundingField = new QComboBox(&dialog);
+    fundingField->addItems({"Keep current", "Budget", "Paid"});
+
+    auto socialField = new QComboBox(&dialog);
+    socialField->addItems({"Keep current", "Yes", "No"});
+
+    auto missedHoursField = new QSpinBox(&dialog);
+    missedHoursField->setRange(-1, 100);
+    missedHoursField->setSpecialValueText("Keep current");
+    missedHoursField->setValue(-1);
+
+    form->addRow("Semester:", semesterMode);
+    form->addRow("", semesterField);
+    form->addRow("Funding Type:", fundingField);
+    form->addRow("Social Scholarship:", socialField);
+    form->addRow("Missed Hours:", missedHoursField);
+
+    auto bb = createButtonBox(&dialog, "Apply");
+    form->addRow(bb);
+    connectButtonBox(bb, &dialog);
+
+    if (dialog.exec() != QDialog::Accepted) {
+        return result;
+    }
+
+    auto choice = [](const QComboBox* field) -> std::optional<bool> {
+        if (field->currentIndex() == 0) return std::nullopt;
+        return field->currentIndex() == 1;
+    };
+    result.setAccepted(true);
+    result.setSemesterChange(
+        static_cast<StudentBulkEditResult::SemesterChange>(semesterMode->currentIndex()),
+        semesterField->value());
+    result.setIsBudget(choice(fundingField));
+    result.setHasSocialScholarship(choice(socialField));
+    if (missedHoursField->value() >= 0) {
+        result.setMissedHours(missedHoursField->value());
+    }
+    return result;
+}
@@ -22,6 +22,7 @@ StudentHistoryDialog::StudentHistoryDialog(QWidget* parent) : parentWidget(paren
 
 void StudentHistoryDialog::showHistory(const std::shared_ptr<Student>& student) {
     if (!student) return;
+    historyGenerator.materializeHistory(*student);
 
     QDialog historyDialog(parentWidget);
     historyDialog.setWindowTitle(